@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_ACCUMULATORS_PUBKEY_AGGREGATE_HPP
 #define CRYPTO3_ACCUMULATORS_PUBKEY_AGGREGATE_HPP
 
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 
@@ -42,6 +43,7 @@
 #include <boost/accumulators/framework/parameters/sample.hpp>
 
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
+#include <nil/crypto3/pubkey/accumulators/parameters/threshold_value.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -59,8 +61,8 @@ namespace nil {
                         typedef typename processing_mode_type::result_type result_type;
 
                         template<typename Args>
-                        aggregate_impl(const Args &) {
-                            processing_mode_type::init_accumulator(acc);
+                        aggregate_impl(const Args &args) {
+                            resolve_init(args[::nil::crypto3::accumulators::threshold_value | nullptr]);
                         }
 
                         template<typename Args>
@@ -74,6 +76,15 @@ namespace nil {
                         }
 
                     protected:
+                        inline void resolve_init(std::nullptr_t) {
+                            processing_mode_type::init_accumulator(acc);
+                        }
+
+                        /// threshold aggregation takes the threshold of the secret sharing the keys are dealt with
+                        inline void resolve_init(std::size_t threshold_number) {
+                            processing_mode_type::init_accumulator(acc, threshold_number);
+                        }
+
                         template<typename InputRange, typename InputIterator>
                         inline void resolve_type(const InputRange &range, InputIterator) {
                             processing_mode_type::update(acc, range);
@@ -42,6 +42,7 @@
 #include <boost/accumulators/framework/parameters/sample.hpp>
 
 #include <nil/crypto3/pubkey/accumulators/parameters/key.hpp>
+#include <nil/crypto3/pubkey/accumulators/parameters/excluded_key.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
 
 #include <nil/crypto3/pubkey/keys/public_key.hpp>
@@ -71,8 +72,9 @@ namespace nil {
 
                         template<typename Args>
                         inline void operator()(const Args &args) {
-                            resolve_type(args[boost::accumulators::sample],
-                                         args[::nil::crypto3::accumulators::iterator_last | nullptr]);
+                            resolve_type(args[boost::accumulators::sample | nullptr],
+                                         args[::nil::crypto3::accumulators::iterator_last | nullptr],
+                                         args[::nil::crypto3::accumulators::excluded_key | nullptr]);
                         }
 
                         inline result_type result(boost::accumulators::dont_care) const {
@@ -83,7 +85,7 @@ namespace nil {
                         //
                         // set verified signature
                         //
-                        inline void resolve_type(const signature_type &new_sig, std::nullptr_t) {
+                        inline void resolve_type(const signature_type &new_sig, std::nullptr_t, std::nullptr_t) {
                             signature = new_sig;
                         }
 
@@ -91,7 +93,7 @@ namespace nil {
                         // append verified msg or add public key for aggregate verification of single msg
                         //
                         template<typename InputRange>
-                        inline void resolve_type(const InputRange &range, std::nullptr_t) {
+                        inline void resolve_type(const InputRange &range, std::nullptr_t, std::nullptr_t) {
                             processing_mode_type::update(acc, range);
                         }
 
@@ -99,10 +101,17 @@ namespace nil {
                         // append verified msg or add public key for aggregate verification of single msg
                         //
                         template<typename InputIterator>
-                        inline void resolve_type(InputIterator first, InputIterator last) {
+                        inline void resolve_type(InputIterator first, InputIterator last, std::nullptr_t) {
                             processing_mode_type::update(acc, first, last);
                         }
 
+                        //
+                        // remove previously added public key from aggregate verification of single msg
+                        //
+                        inline void resolve_type(std::nullptr_t, std::nullptr_t, const key_type &excluded) {
+                            processing_mode_type::exclude(acc, excluded);
+                        }
+
                         signature_type signature;
                         mutable internal_accumulator_type acc;
                     };
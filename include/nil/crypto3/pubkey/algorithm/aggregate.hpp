@@ -34,6 +34,8 @@
 #include <nil/crypto3/pubkey/operations/aggregate_op.hpp>
 
 #include <nil/crypto3/pubkey/modes/isomorphic.hpp>
+#include <nil/crypto3/pubkey/modes/parallel.hpp>
+#include <nil/crypto3/pubkey/modes/threshold.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -44,6 +46,15 @@ namespace nil {
             template<typename Scheme>
             using aggregation_processing_mode_default =
                 typename modes::isomorphic<Scheme>::template bind<aggregation_policy<Scheme>>::type;
+
+            template<typename Scheme, typename Executor = detail::thread_executor>
+            using parallel_aggregation_processing_mode = typename modes::parallel<Scheme, Executor>::template bind<
+                typename modes::parallel<Scheme, Executor>::aggregation_policy>::type;
+
+            template<typename Scheme, template<typename> class SecretSharingScheme = shamir_sss>
+            using threshold_aggregation_processing_mode =
+                typename modes::threshold<Scheme, SecretSharingScheme>::template bind<
+                    typename modes::threshold<Scheme, SecretSharingScheme>::aggregation_policy>::type;
         }    // namespace pubkey
 
         /*!
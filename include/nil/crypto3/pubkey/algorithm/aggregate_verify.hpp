@@ -32,6 +32,8 @@
 #include <nil/crypto3/pubkey/pubkey_state.hpp>
 
 #include <nil/crypto3/pubkey/modes/isomorphic.hpp>
+#include <nil/crypto3/pubkey/modes/parallel.hpp>
+#include <nil/crypto3/pubkey/modes/pipelined.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -43,6 +45,16 @@ namespace nil {
             template<typename Scheme>
             using aggregate_verification_processing_mode_default =
                 typename modes::isomorphic<Scheme>::template bind<aggregate_verification_policy<Scheme>>::type;
+
+            template<typename Scheme, typename Executor = detail::thread_executor>
+            using parallel_aggregate_verification_processing_mode =
+                typename modes::parallel<Scheme, Executor>::template bind<
+                    typename modes::parallel<Scheme, Executor>::aggregate_verification_policy>::type;
+
+            template<typename Scheme>
+            using pipelined_aggregate_verification_processing_mode =
+                typename modes::pipelined<Scheme>::template bind<
+                    typename modes::pipelined<Scheme>::aggregate_verification_policy>::type;
         }    // namespace pubkey
 
         /*!
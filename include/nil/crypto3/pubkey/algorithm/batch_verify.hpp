@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_BATCH_VERIFY_HPP
+#define CRYPTO3_PUBKEY_BATCH_VERIFY_HPP
+
+#include <iterator>
+
+#include <nil/crypto3/pubkey/algorithm/pubkey.hpp>
+
+#include <nil/crypto3/pubkey/pubkey_value.hpp>
+#include <nil/crypto3/pubkey/pubkey_state.hpp>
+
+#include <nil/crypto3/pubkey/operations/batch_verify_op.hpp>
+
+#include <nil/crypto3/pubkey/modes/isomorphic.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            template<typename Scheme>
+            using batch_verification_policy = typename pubkey::modes::isomorphic<Scheme>::batch_verification_policy;
+
+            template<typename Scheme>
+            using batch_verification_processing_mode_default =
+                typename modes::isomorphic<Scheme>::template bind<batch_verification_policy<Scheme>>::type;
+        }    // namespace pubkey
+
+        /*!
+         * @brief Batch verification of independent signatures, each created for its own message on its own key.
+         * Result is true only if every signature in the batch is valid. Ranges of different lengths or an empty batch
+         * give false.
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam MessagesRange range of ranges representing input messages
+         * @tparam SignaturesRange range representing input signatures
+         * @tparam KeysRange range representing input public keys
+         * @tparam ProcessingMode a policy representing a work mode of the scheme, by default isomorphic, which means
+         * executing a batch verification operation as in specification
+         * @tparam BatchVerificationAccumulator accumulator set initialized with batch verification accumulator
+         * (internal parameter)
+         *
+         * @param msgs messages range, i-th message corresponds to the i-th signature and the i-th key
+         * @param signatures signatures to verify
+         * @param keys public keys to be used for verification
+         *
+         * @return \p ProcessingMode::result_type
+         */
+        template<typename Scheme, typename MessagesRange, typename SignaturesRange, typename KeysRange,
+                 typename ProcessingMode = pubkey::batch_verification_processing_mode_default<Scheme>,
+                 typename BatchVerificationAccumulator = pubkey::batch_verification_accumulator_set<ProcessingMode>>
+        typename ProcessingMode::result_type batch_verify(const MessagesRange &msgs, const SignaturesRange &signatures,
+                                                          const KeysRange &keys) {
+            typedef typename boost::mpl::front<typename BatchVerificationAccumulator::features_type>::type
+                accumulator_type;
+
+            // every message needs its signature and its key, a partial or an empty batch proves nothing
+            const auto batch_size = std::distance(std::cbegin(msgs), std::cend(msgs));
+            if (batch_size == 0 || batch_size != std::distance(std::cbegin(signatures), std::cend(signatures)) ||
+                batch_size != std::distance(std::cbegin(keys), std::cend(keys))) {
+                return typename ProcessingMode::result_type(false);
+            }
+
+            BatchVerificationAccumulator acc;
+
+            auto msgs_it = std::cbegin(msgs);
+            auto sigs_it = std::cbegin(signatures);
+            auto keys_it = std::cbegin(keys);
+            while (msgs_it != std::cend(msgs) && sigs_it != std::cend(signatures) && keys_it != std::cend(keys)) {
+                const pubkey::public_key<Scheme> &key = *keys_it++;
+                acc(*msgs_it++, ::nil::crypto3::accumulators::key = key,
+                    ::nil::crypto3::accumulators::signature = *sigs_it++);
+            }
+
+            return boost::accumulators::extract_result<accumulator_type>(acc);
+        }
+
+        /*!
+         * @brief Updating of accumulator set \p acc containing batch verification accumulator with input message,
+         * its signature and corresponding public key
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam InputIterator iterator representing input message
+         * @tparam ProcessingMode a policy representing a work mode of the scheme, by default isomorphic, which means
+         * executing a batch verification operation as in specification
+         * @tparam OutputAccumulator accumulator set initialized with batch verification accumulator (internal
+         * parameter)
+         *
+         * @param first the beginning of the message range
+         * @param last the end of the message range
+         * @param signature signature of the message to verify
+         * @param key public key to be used for verification of the message
+         * @param acc accumulator set containing batch verification accumulator possibly pre-initialized with a part
+         * of the batch
+         *
+         * @return \p OutputAccumulator
+         */
+        template<typename Scheme, typename InputIterator,
+                 typename ProcessingMode = pubkey::batch_verification_processing_mode_default<Scheme>,
+                 typename OutputAccumulator = pubkey::batch_verification_accumulator_set<ProcessingMode>>
+        typename std::enable_if<boost::accumulators::detail::is_accumulator_set<OutputAccumulator>::value,
+                                OutputAccumulator>::type &
+            batch_verify(InputIterator first, InputIterator last,
+                         const typename pubkey::public_key<Scheme>::signature_type &signature,
+                         const pubkey::public_key<Scheme> &key, OutputAccumulator &acc) {
+            typedef pubkey::detail::ref_pubkey_impl<OutputAccumulator> StreamSchemeImpl;
+            typedef pubkey::detail::range_pubkey_impl<StreamSchemeImpl> SchemeImpl;
+
+            return SchemeImpl(first, last, std::forward<OutputAccumulator>(acc), key, signature);
+        }
+
+        /*!
+         * @brief Updating of accumulator set \p acc containing batch verification accumulator with input message,
+         * its signature and corresponding public key
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam SinglePassRange range representing input message
+         * @tparam ProcessingMode a policy representing a work mode of the scheme, by default isomorphic, which means
+         * executing a batch verification operation as in specification
+         * @tparam OutputAccumulator accumulator set initialized with batch verification accumulator (internal
+         * parameter)
+         *
+         * @param range the message range
+         * @param signature signature of the message to verify
+         * @param key public key to be used for verification of the message
+         * @param acc accumulator set containing batch verification accumulator possibly pre-initialized with a part
+         * of the batch
+         *
+         * @return \p OutputAccumulator
+         */
+        template<typename Scheme, typename SinglePassRange,
+                 typename ProcessingMode = pubkey::batch_verification_processing_mode_default<Scheme>,
+                 typename OutputAccumulator = pubkey::batch_verification_accumulator_set<ProcessingMode>>
+        typename std::enable_if<boost::accumulators::detail::is_accumulator_set<OutputAccumulator>::value,
+                                OutputAccumulator>::type &
+            batch_verify(const SinglePassRange &range,
+                         const typename pubkey::public_key<Scheme>::signature_type &signature,
+                         const pubkey::public_key<Scheme> &key, OutputAccumulator &acc) {
+            typedef pubkey::detail::ref_pubkey_impl<OutputAccumulator> StreamSchemeImpl;
+            typedef pubkey::detail::range_pubkey_impl<StreamSchemeImpl> SchemeImpl;
+
+            return SchemeImpl(range, std::forward<OutputAccumulator>(acc), key, signature);
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // include guard
@@ -0,0 +1,79 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_VALIDATE_SIGNATURES_HPP
+#define CRYPTO3_PUBKEY_VALIDATE_SIGNATURES_HPP
+
+#include <iterator>
+
+#include <nil/crypto3/pubkey/keys/public_key.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        /*!
+         * @brief Validation of a batch of signatures received from an untrusted source, checking each of them to be
+         * a valid group element of the scheme, e.g. on the curve and in the subgroup. Intended as a pre-filter before
+         * aggregation or verification, parts of the batch could be validated in parallel.
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam InputIterator iterator representing input signatures
+         * @tparam OutputIterator iterator representing output range with value type of bool
+         *
+         * @param first the beginning of the signatures range
+         * @param last the end of the signatures range
+         * @param out the beginning of the output range receiving the result of every signature validation
+         *
+         * @return \p OutputIterator
+         */
+        template<typename Scheme, typename InputIterator, typename OutputIterator>
+        OutputIterator validate_signatures(InputIterator first, InputIterator last, OutputIterator out) {
+            return pubkey::public_key<Scheme>::validate_signatures(first, last, out);
+        }
+
+        /*!
+         * @brief Validation of a batch of signatures received from an untrusted source, checking each of them to be
+         * a valid group element of the scheme, e.g. on the curve and in the subgroup.
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam SinglePassRange range representing input signatures
+         * @tparam OutputIterator iterator representing output range with value type of bool
+         *
+         * @param range the signatures range
+         * @param out the beginning of the output range receiving the result of every signature validation
+         *
+         * @return \p OutputIterator
+         */
+        template<typename Scheme, typename SinglePassRange, typename OutputIterator>
+        OutputIterator validate_signatures(const SinglePassRange &range, OutputIterator out) {
+            return validate_signatures<Scheme>(std::cbegin(range), std::cend(range), out);
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_VALIDATE_SIGNATURES_HPP
@@ -26,11 +26,16 @@
 #ifndef CRYPTO3_PUBKEY_BLS_HPP
 #define CRYPTO3_PUBKEY_BLS_HPP
 
+#include <array>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <vector>
 #include <iterator>
 #include <type_traits>
 #include <utility>
+#include <tuple>
 #include <functional>
 
 #include <boost/assert.hpp>
@@ -50,9 +55,18 @@
 #include <nil/crypto3/pubkey/detail/bls/bls_basic_policy.hpp>
 #include <nil/crypto3/pubkey/detail/bls/bls_basic_functions.hpp>
 #include <nil/crypto3/pubkey/keys/private_key.hpp>
+#include <nil/crypto3/pubkey/keys/prepared_public_key.hpp>
+#include <nil/crypto3/pubkey/keys/validated_public_key.hpp>
+#include <nil/crypto3/pubkey/keys/pop_registry.hpp>
+#include <nil/crypto3/pubkey/keys/validator_registry.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_op.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_verify_op.hpp>
 #include <nil/crypto3/pubkey/operations/aggregate_verify_single_msg_op.hpp>
+#include <nil/crypto3/pubkey/operations/batch_verify_op.hpp>
+#include <nil/crypto3/pubkey/operations/pipelined_aggregate_verify_op.hpp>
+#include <nil/crypto3/pubkey/operations/threshold_aggregate_op.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/lagrange_coefficients_cache.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/weighted_shamir.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -72,14 +86,21 @@ namespace nil {
                 typedef typename basic_functions::public_key_type public_key_type;
                 typedef typename basic_functions::signature_type signature_type;
 
+                typedef typename basic_functions::prepared_public_key_type prepared_public_key_type;
+
                 typedef typename basic_functions::internal_accumulator_type internal_accumulator_type;
                 typedef typename basic_functions::internal_aggregation_accumulator_type
                     internal_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_batch_verification_accumulator_type
+                    internal_batch_verification_accumulator_type;
 
                 static inline public_key_type generate_public_key(const private_key_type &privkey) {
                     return basic_functions::privkey_to_pubkey(privkey);
                 }
 
+                /// messages are hashed as is, accumulators start empty
+                constexpr static const bool augments_messages = false;
+
                 static inline void init_accumulator(internal_accumulator_type &acc, const private_key_type &privkey) {
                 }
 
@@ -105,6 +126,30 @@ namespace nil {
                     return basic_functions::verify(acc, pubkey, sig);
                 }
 
+                static inline prepared_public_key_type prepare_public_key(const public_key_type &pubkey) {
+                    return basic_functions::prepare_public_key(pubkey);
+                }
+
+                static inline bool verify(internal_accumulator_type &acc, const prepared_public_key_type &pubkey,
+                                          const signature_type &sig) {
+                    return basic_functions::verify(acc, pubkey, sig);
+                }
+
+                static inline bool verify_validated(internal_accumulator_type &acc, const public_key_type &pubkey,
+                                                    const signature_type &sig) {
+                    return basic_functions::verify_validated(acc, pubkey, sig);
+                }
+
+                static inline bool verify_validated(internal_accumulator_type &acc,
+                                                    const prepared_public_key_type &pubkey,
+                                                    const signature_type &sig) {
+                    return basic_functions::verify_validated(acc, pubkey, sig);
+                }
+
+                static inline bool batch_verify(internal_batch_verification_accumulator_type &acc) {
+                    return basic_functions::batch_verify(acc);
+                }
+
                 template<typename SignatureRange>
                 static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
                     basic_functions::aggregate(acc, signatures);
@@ -116,11 +161,28 @@ namespace nil {
                     basic_functions::aggregate(acc, sig_first, sig_last);
                 }
 
+                template<typename Executor, typename SignatureRange>
+                static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
+                    basic_functions::template aggregate<Executor>(acc, signatures);
+                }
+
+                template<typename Executor, typename SignatureIterator>
+                static inline void update_aggregate(signature_type &acc, SignatureIterator sig_first,
+                                                    SignatureIterator sig_last) {
+                    basic_functions::template aggregate<Executor>(acc, sig_first, sig_last);
+                }
+
                 static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
                                                     const signature_type &signature) {
                     // TODO: add check - If any two input messages are equal, return INVALID.
                     return basic_functions::aggregate_verify(acc, signature);
                 }
+
+                template<typename Executor>
+                static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::template aggregate_verify<Executor>(acc, signature);
+                }
             };
 
             /*!
@@ -138,14 +200,21 @@ namespace nil {
                 typedef typename basic_functions::public_key_type public_key_type;
                 typedef typename basic_functions::signature_type signature_type;
 
+                typedef typename basic_functions::prepared_public_key_type prepared_public_key_type;
+
                 typedef typename basic_functions::internal_accumulator_type internal_accumulator_type;
                 typedef typename basic_functions::internal_aggregation_accumulator_type
                     internal_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_batch_verification_accumulator_type
+                    internal_batch_verification_accumulator_type;
 
                 static inline public_key_type generate_public_key(const private_key_type &privkey) {
                     return basic_functions::privkey_to_pubkey(privkey);
                 }
 
+                /// messages are prefixed with the serialized public key, which is absorbed by init_accumulator
+                constexpr static const bool augments_messages = true;
+
                 static inline void init_accumulator(internal_accumulator_type &acc, const private_key_type &privkey) {
                     init_accumulator(acc, generate_public_key(privkey));
                 }
@@ -173,6 +242,30 @@ namespace nil {
                     return basic_functions::verify(acc, pubkey, sig);
                 }
 
+                static inline prepared_public_key_type prepare_public_key(const public_key_type &pubkey) {
+                    return basic_functions::prepare_public_key(pubkey);
+                }
+
+                static inline bool verify(internal_accumulator_type &acc, const prepared_public_key_type &pubkey,
+                                          const signature_type &sig) {
+                    return basic_functions::verify(acc, pubkey, sig);
+                }
+
+                static inline bool verify_validated(internal_accumulator_type &acc, const public_key_type &pubkey,
+                                                    const signature_type &sig) {
+                    return basic_functions::verify_validated(acc, pubkey, sig);
+                }
+
+                static inline bool verify_validated(internal_accumulator_type &acc,
+                                                    const prepared_public_key_type &pubkey,
+                                                    const signature_type &sig) {
+                    return basic_functions::verify_validated(acc, pubkey, sig);
+                }
+
+                static inline bool batch_verify(internal_batch_verification_accumulator_type &acc) {
+                    return basic_functions::batch_verify(acc);
+                }
+
                 template<typename SignatureRange>
                 static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
                     basic_functions::aggregate(acc, signatures);
@@ -184,10 +277,27 @@ namespace nil {
                     basic_functions::aggregate(acc, sig_first, sig_last);
                 }
 
+                template<typename Executor, typename SignatureRange>
+                static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
+                    basic_functions::template aggregate<Executor>(acc, signatures);
+                }
+
+                template<typename Executor, typename SignatureIterator>
+                static inline void update_aggregate(signature_type &acc, SignatureIterator sig_first,
+                                                    SignatureIterator sig_last) {
+                    basic_functions::template aggregate<Executor>(acc, sig_first, sig_last);
+                }
+
                 static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
                                                     const signature_type &signature) {
                     return basic_functions::aggregate_verify(acc, signature);
                 }
+
+                template<typename Executor>
+                static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::template aggregate_verify<Executor>(acc, signature);
+                }
             };
 
             /*!
@@ -205,16 +315,24 @@ namespace nil {
                 typedef typename basic_functions::public_key_type public_key_type;
                 typedef typename basic_functions::signature_type signature_type;
 
+                typedef typename basic_functions::prepared_public_key_type prepared_public_key_type;
+
                 typedef typename basic_functions::internal_accumulator_type internal_accumulator_type;
                 typedef typename basic_functions::internal_aggregation_accumulator_type
                     internal_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_batch_verification_accumulator_type
+                    internal_batch_verification_accumulator_type;
                 typedef typename basic_functions::internal_fast_aggregation_accumulator_type
                     internal_fast_aggregation_accumulator_type;
+                typedef typename basic_functions::public_key_set_type public_key_set_type;
 
                 static inline public_key_type generate_public_key(const private_key_type &privkey) {
                     return basic_functions::privkey_to_pubkey(privkey);
                 }
 
+                /// messages are hashed as is, accumulators start empty
+                constexpr static const bool augments_messages = false;
+
                 static inline void init_accumulator(internal_accumulator_type &acc, const private_key_type &privkey) {
                 }
 
@@ -240,6 +358,30 @@ namespace nil {
                     return basic_functions::verify(acc, pubkey, sig);
                 }
 
+                static inline prepared_public_key_type prepare_public_key(const public_key_type &pubkey) {
+                    return basic_functions::prepare_public_key(pubkey);
+                }
+
+                static inline bool verify(internal_accumulator_type &acc, const prepared_public_key_type &pubkey,
+                                          const signature_type &sig) {
+                    return basic_functions::verify(acc, pubkey, sig);
+                }
+
+                static inline bool verify_validated(internal_accumulator_type &acc, const public_key_type &pubkey,
+                                                    const signature_type &sig) {
+                    return basic_functions::verify_validated(acc, pubkey, sig);
+                }
+
+                static inline bool verify_validated(internal_accumulator_type &acc,
+                                                    const prepared_public_key_type &pubkey,
+                                                    const signature_type &sig) {
+                    return basic_functions::verify_validated(acc, pubkey, sig);
+                }
+
+                static inline bool batch_verify(internal_batch_verification_accumulator_type &acc) {
+                    return basic_functions::batch_verify(acc);
+                }
+
                 template<typename SignatureRange>
                 static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
                     basic_functions::aggregate(acc, signatures);
@@ -251,9 +393,27 @@ namespace nil {
                     basic_functions::aggregate(acc, sig_first, sig_last);
                 }
 
+                template<typename Executor, typename SignatureRange>
+                static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
+                    basic_functions::template aggregate<Executor>(acc, signatures);
+                }
+
+                template<typename Executor, typename SignatureIterator>
+                static inline void update_aggregate(signature_type &acc, SignatureIterator sig_first,
+                                                    SignatureIterator sig_last) {
+                    basic_functions::template aggregate<Executor>(acc, sig_first, sig_last);
+                }
+
                 static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
                                                     const signature_type &signature) {
-                    return basic_functions::aggregate_verify(acc, signature);
+                    // public keys are protected by proofs of possession, so keys of the same message could be summed
+                    return basic_functions::aggregate_verify_by_message(acc, signature);
+                }
+
+                template<typename Executor>
+                static inline bool aggregate_verify(internal_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::template aggregate_verify<Executor>(acc, signature);
                 }
 
                 static inline bool aggregate_verify(internal_fast_aggregation_accumulator_type &acc,
@@ -261,6 +421,16 @@ namespace nil {
                     return basic_functions::aggregate_verify(acc, signature);
                 }
 
+                static inline bool add_public_key(internal_fast_aggregation_accumulator_type &acc,
+                                                  const public_key_type &pubkey, bool validated = false) {
+                    return basic_functions::add_public_key(acc, pubkey, validated);
+                }
+
+                static inline bool remove_public_key(internal_fast_aggregation_accumulator_type &acc,
+                                                     const public_key_type &pubkey) {
+                    return basic_functions::remove_public_key(acc, pubkey);
+                }
+
                 static inline signature_type pop_prove(const private_key_type &privkey) {
                     return basic_functions::pop_prove(privkey);
                 }
@@ -268,6 +438,132 @@ namespace nil {
                 static inline bool pop_verify(const public_key_type &pubkey, const signature_type &proof) {
                     return basic_functions::pop_verify(pubkey, proof);
                 }
+
+                template<typename Generator, typename PublicKeyIterator, typename SignatureIterator,
+                         typename OutputIterator>
+                static inline OutputIterator pop_batch_verify(PublicKeyIterator pubkey_first,
+                                                              PublicKeyIterator pubkey_last,
+                                                              SignatureIterator proof_first, OutputIterator out) {
+                    return basic_functions::template pop_batch_verify<Generator>(pubkey_first, pubkey_last,
+                                                                                 proof_first, out);
+                }
+
+                static inline void restrict_public_keys(internal_fast_aggregation_accumulator_type &acc,
+                                                        const public_key_set_type &registered_keys) {
+                    basic_functions::restrict_public_keys(acc, registered_keys);
+                }
+            };
+
+            /*!
+             * @brief Multisignature BLS Scheme (MSP of BDN18), secure against rogue key attacks without proofs of
+             * possession: signatures and public keys of the same message are combined with key aggregation
+             * coefficients
+             * @tparam SignatureVersion
+             * @see https://eprint.iacr.org/2018/483
+             */
+            template<typename SignatureVersion>
+            struct bls_msp_scheme {
+                typedef SignatureVersion signature_version;
+                typedef typename signature_version::basic_functions basic_functions;
+
+                typedef typename basic_functions::private_key_type private_key_type;
+                typedef typename basic_functions::public_key_type public_key_type;
+                typedef typename basic_functions::signature_type signature_type;
+
+                typedef typename basic_functions::prepared_public_key_type prepared_public_key_type;
+
+                typedef typename basic_functions::internal_accumulator_type internal_accumulator_type;
+                typedef typename basic_functions::internal_batch_verification_accumulator_type
+                    internal_batch_verification_accumulator_type;
+                typedef typename basic_functions::internal_key_aggregation_accumulator_type
+                    internal_key_aggregation_accumulator_type;
+                typedef typename basic_functions::internal_keyed_aggregation_accumulator_type
+                    internal_keyed_aggregation_accumulator_type;
+
+                static inline public_key_type generate_public_key(const private_key_type &privkey) {
+                    return basic_functions::privkey_to_pubkey(privkey);
+                }
+
+                /// messages are hashed as is, accumulators start empty
+                constexpr static const bool augments_messages = false;
+
+                static inline void init_accumulator(internal_accumulator_type &acc, const private_key_type &privkey) {
+                }
+
+                static inline void init_accumulator(internal_accumulator_type &acc, const public_key_type &pubkey) {
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, const InputRange &range) {
+                    basic_functions::update(acc, range);
+                }
+
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    basic_functions::update(acc, first, last);
+                }
+
+                static inline signature_type sign(internal_accumulator_type &acc, const private_key_type &privkey) {
+                    return basic_functions::sign(acc, privkey);
+                }
+
+                static inline bool verify(internal_accumulator_type &acc, const public_key_type &pubkey,
+                                          const signature_type &sig) {
+                    return basic_functions::verify(acc, pubkey, sig);
+                }
+
+                static inline prepared_public_key_type prepare_public_key(const public_key_type &pubkey) {
+                    return basic_functions::prepare_public_key(pubkey);
+                }
+
+                static inline bool verify(internal_accumulator_type &acc, const prepared_public_key_type &pubkey,
+                                          const signature_type &sig) {
+                    return basic_functions::verify(acc, pubkey, sig);
+                }
+
+                static inline bool verify_validated(internal_accumulator_type &acc, const public_key_type &pubkey,
+                                                    const signature_type &sig) {
+                    return basic_functions::verify_validated(acc, pubkey, sig);
+                }
+
+                static inline bool verify_validated(internal_accumulator_type &acc,
+                                                    const prepared_public_key_type &pubkey,
+                                                    const signature_type &sig) {
+                    return basic_functions::verify_validated(acc, pubkey, sig);
+                }
+
+                static inline bool batch_verify(internal_batch_verification_accumulator_type &acc) {
+                    return basic_functions::batch_verify(acc);
+                }
+
+                static inline public_key_type aggregate_public_keys(const std::vector<public_key_type> &pubkeys) {
+                    return basic_functions::aggregate_public_keys(pubkeys);
+                }
+
+                static inline signature_type aggregate_signatures(const std::vector<public_key_type> &pubkeys,
+                                                                  const std::vector<signature_type> &signatures) {
+                    return basic_functions::aggregate_signatures(pubkeys, signatures);
+                }
+
+                static inline bool aggregate_verify(internal_key_aggregation_accumulator_type &acc,
+                                                    const signature_type &signature) {
+                    return basic_functions::aggregate_verify(acc, signature);
+                }
+
+                static inline bool add_public_key(internal_key_aggregation_accumulator_type &acc,
+                                                  const public_key_type &pubkey, bool validated = false) {
+                    return basic_functions::add_public_key(acc, pubkey, validated);
+                }
+
+                static inline bool remove_public_key(internal_key_aggregation_accumulator_type &acc,
+                                                     const public_key_type &pubkey) {
+                    return basic_functions::remove_public_key(acc, pubkey);
+                }
+
+                static inline bool add_signature(internal_keyed_aggregation_accumulator_type &acc,
+                                                 const public_key_type &pubkey, const signature_type &signature) {
+                    return basic_functions::add_signature(acc, pubkey, signature);
+                }
             };
 
             //
@@ -310,12 +606,12 @@ namespace nil {
                 constexpr static hashes::UniformityCount uniformity_count = _uniformity_count;
                 constexpr static hashes::ExpandMsgVariant expand_msg_variant = _expand_msg_variant;
 
-                typedef std::vector<std::uint8_t> dst_type;
-                static inline dst_type dst = []() {
-                    const std::string _dst_str = "BLS_POP_BLS12381G1_XMD:SHA-256_SSWU_RO_POP_";
-                    const std::vector<std::uint8_t> _dst(_dst_str.begin(), _dst_str.end());
-                    return _dst;
-                }();
+                // "BLS_POP_BLS12381G1_XMD:SHA-256_SSWU_RO_POP_"
+                typedef std::array<std::uint8_t, 43> dst_type;
+                static constexpr dst_type dst = {0x42, 0x4c, 0x53, 0x5f, 0x50, 0x4f, 0x50, 0x5f, 0x42, 0x4c, 0x53,
+                                                 0x31, 0x32, 0x33, 0x38, 0x31, 0x47, 0x31, 0x5f, 0x58, 0x4d, 0x44,
+                                                 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x53,
+                                                 0x57, 0x55, 0x5f, 0x52, 0x4f, 0x5f, 0x50, 0x4f, 0x50, 0x5f};
             };
 
             template<hashes::UniformityCount _uniformity_count = hashes::UniformityCount::uniform_count,
@@ -324,12 +620,12 @@ namespace nil {
                 constexpr static hashes::UniformityCount uniformity_count = _uniformity_count;
                 constexpr static hashes::ExpandMsgVariant expand_msg_variant = _expand_msg_variant;
 
-                typedef std::vector<std::uint8_t> dst_type;
-                static inline dst_type dst = []() {
-                    const std::string _dst_str = "BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_POP_";
-                    const std::vector<std::uint8_t> _dst(_dst_str.begin(), _dst_str.end());
-                    return _dst;
-                }();
+                // "BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_POP_"
+                typedef std::array<std::uint8_t, 43> dst_type;
+                static constexpr dst_type dst = {0x42, 0x4c, 0x53, 0x5f, 0x53, 0x49, 0x47, 0x5f, 0x42, 0x4c, 0x53,
+                                                 0x31, 0x32, 0x33, 0x38, 0x31, 0x47, 0x32, 0x5f, 0x58, 0x4d, 0x44,
+                                                 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x53,
+                                                 0x57, 0x55, 0x5f, 0x52, 0x4f, 0x5f, 0x50, 0x4f, 0x50, 0x5f};
             };
 
             template<typename PublicParams = bls_default_public_params<>,
@@ -345,6 +641,7 @@ namespace nil {
                 typedef private_key<self_type> private_key_type;
                 typedef aggregate_op<self_type> aggregate_op_policy;
                 typedef aggregate_verify_op<self_type> aggregate_verify_op_policy;
+                typedef batch_verify_op<self_type> batch_verify_op_policy;
             };
 
             template<typename PublicParams, template<typename, typename> class BlsVersion,
@@ -360,16 +657,25 @@ namespace nil {
                 typedef typename public_key_type::group_type public_key_group_type;
                 typedef typename signature_type::group_type signature_group_type;
 
+                typedef typename bls_scheme_type::prepared_public_key_type prepared_public_key_type;
                 typedef typename bls_scheme_type::internal_accumulator_type internal_accumulator_type;
+                typedef typename bls_scheme_type::basic_functions::prepared_message_type prepared_message_type;
 
                 typedef public_key_type key_type;
 
                 public_key() = delete;
-                public_key(const key_type &pubkey) : pubkey(pubkey) {
+                public_key(const key_type &pubkey) :
+                    pubkey(std::make_shared<const key_type>(pubkey)), augmented_accumulator(augmented_slot()) {
                 }
 
                 inline void init_accumulator(internal_accumulator_type &acc) const {
-                    bls_scheme_type::init_accumulator(acc, pubkey);
+                    if (augmented_accumulator) {
+                        std::call_once(augmented_accumulator->built,
+                                       [this]() { augmented_accumulator->acc = augment(*pubkey); });
+                        acc = *augmented_accumulator->acc;
+                        return;
+                    }
+                    bls_scheme_type::init_accumulator(acc, *pubkey);
                 }
 
                 template<typename InputRange>
@@ -382,173 +688,999 @@ namespace nil {
                     bls_scheme_type::update(acc, first, last);
                 }
 
-                inline bool verify(internal_accumulator_type &acc, const signature_type &sig) const {
-                    return bls_scheme_type::verify(acc, pubkey, sig);
+                /// new accumulator initialized with the key and holding the whole message [first, last), used by the
+                /// operations taking a message per key
+                template<typename InputIterator>
+                inline internal_accumulator_type absorb_message(InputIterator first, InputIterator last) const {
+                    internal_accumulator_type acc;
+                    init_accumulator(acc);
+                    update(acc, first, last);
+                    return acc;
                 }
 
-                inline public_key_type public_key_data() const {
-                    return pubkey;
+                template<typename InputRange>
+                inline internal_accumulator_type absorb_message(const InputRange &range) const {
+                    internal_accumulator_type acc;
+                    init_accumulator(acc);
+                    update(acc, range);
+                    return acc;
                 }
 
-                // TODO: refactor pop
-                template<typename FakeAccumulator>
-                inline bool pop_verify(FakeAccumulator, const signature_type &proof) const {
-                    return bls_scheme_type::pop_verify(pubkey, proof);
+                inline bool verify(internal_accumulator_type &acc, const signature_type &sig) const {
+                    if (prepared) {
+                        return validated ? bls_scheme_type::verify_validated(acc, *prepared, sig) :
+                                           bls_scheme_type::verify(acc, *prepared, sig);
+                    }
+                    return validated ? bls_scheme_type::verify_validated(acc, *pubkey, sig) :
+                                       bls_scheme_type::verify(acc, *pubkey, sig);
                 }
 
-                // FIXME: copy pubkey between equivalent public keys is a bottleneck
-                // TODO: support using of the same pubkey even if scheme policy differs in public params and scheme type
-                template<typename ToPublicParams, template<typename> class ToBlsScheme>
-                operator public_key<bls<ToPublicParams, BlsVersion, ToBlsScheme, CurveType>>() const {
-                    return public_key<bls<ToPublicParams, BlsVersion, BlsScheme, CurveType>>(pubkey);
+                /// verify \p sig over a message hashed beforehand, e.g. taken from hashed_message_cache
+                inline bool verify(const prepared_message_type &msg, const signature_type &sig) const {
+                    typedef typename bls_scheme_type::basic_functions basic_functions;
+                    static_assert(!bls_scheme_type::augments_messages,
+                                  "hashed messages depend on the public key in the message augmentation scheme");
+
+                    if (prepared) {
+                        return validated ? basic_functions::verify_validated(msg, *prepared, sig) :
+                                           basic_functions::verify(msg, *prepared, sig);
+                    }
+                    return validated ? basic_functions::verify_validated(msg, *pubkey, sig) :
+                                       basic_functions::verify(msg, *pubkey, sig);
                 }
 
-            protected:
-                public_key_type pubkey;
-            };
+                /// hash \p range to the curve once, so it could be verified against many keys and signatures
+                template<typename InputRange>
+                static inline prepared_message_type hash_message(const InputRange &range) {
+                    static_assert(!bls_scheme_type::augments_messages,
+                                  "hashed messages depend on the public key in the message augmentation scheme");
+                    return bls_scheme_type::basic_functions::hash_message(range);
+                }
 
-            template<typename PublicParams, template<typename, typename> class BlsVersion,
-                     template<typename> class BlsScheme, typename CurveType>
-            struct private_key<bls<PublicParams, BlsVersion, BlsScheme, CurveType>>
-                : public public_key<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
-                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
-                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
-                typedef public_key<scheme_type> base_type;
+                inline const public_key_type &public_key_data() const {
+                    return *pubkey;
+                }
 
-                typedef typename base_type::private_key_type private_key_type;
-                typedef typename base_type::public_key_type public_key_type;
-                typedef typename base_type::signature_type signature_type;
+                inline bool is_prepared() const {
+                    return static_cast<bool>(prepared);
+                }
 
-                typedef typename bls_scheme_type::internal_accumulator_type internal_accumulator_type;
+                /// precomputed Miller loop lines of the key, only available if is_prepared()
+                inline const prepared_public_key_type &prepared_public_key_data() const {
+                    BOOST_ASSERT(prepared);
+                    return *prepared;
+                }
 
-                typedef private_key_type key_type;
+                inline bool is_validated() const {
+                    return validated;
+                }
 
-                private_key() = delete;
-                private_key(const key_type &privkey) :
-                    privkey(privkey), base_type(bls_scheme_type::generate_public_key(privkey)) {
+                /// check signatures in [first, last) to be on the curve and in the subgroup, writing a bool per
+                /// signature to \p out, e.g. to drop invalid ones before aggregation or verification
+                template<typename SignatureIterator, typename OutputIterator>
+                static inline OutputIterator validate_signatures(SignatureIterator first, SignatureIterator last,
+                                                                 OutputIterator out) {
+                    return bls_scheme_type::basic_functions::validate_signatures(first, last, out);
                 }
 
-                inline void init_accumulator(internal_accumulator_type &acc) const {
-                    bls_scheme_type::init_accumulator(acc, privkey);
+                /// decode \p count compressed public keys stored back to back in \p data in parallel, a bool per key
+                /// is written to \p valid, see bls_basic_functions::pubkeys_from_octets
+                static inline std::size_t public_keys_from_octets(const std::uint8_t *data, std::size_t count,
+                                                                  public_key_type *points, bool *valid) {
+                    return bls_scheme_type::basic_functions::pubkeys_from_octets(data, count, points, valid);
                 }
 
-                template<typename InputRange>
-                static inline void update(internal_accumulator_type &acc, const InputRange &range) {
-                    bls_scheme_type::update(acc, range);
+                /// the same as public_keys_from_octets for compressed signatures
+                static inline std::size_t signatures_from_octets(const std::uint8_t *data, std::size_t count,
+                                                                 signature_type *points, bool *valid) {
+                    return bls_scheme_type::basic_functions::signatures_from_octets(data, count, points, valid);
                 }
 
-                template<typename InputIterator>
-                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
-                    bls_scheme_type::update(acc, first, last);
+                /// compress \p count public keys into \p out with a single field inversion for all of them, see
+                /// bls_basic_functions::pubkeys_to_octets
+                static inline void public_keys_to_octets(const public_key_type *points, std::size_t count,
+                                                         std::uint8_t *out) {
+                    bls_scheme_type::basic_functions::pubkeys_to_octets(points, count, out);
                 }
 
-                inline signature_type sign(internal_accumulator_type &acc) const {
-                    return bls_scheme_type::sign(acc, privkey);
+                /// the same as public_keys_to_octets for signatures
+                static inline void signatures_to_octets(const signature_type *points, std::size_t count,
+                                                        std::uint8_t *out) {
+                    bls_scheme_type::basic_functions::signatures_to_octets(points, count, out);
                 }
 
-                inline signature_type pop_prove() const {
-                    return bls_scheme_type::pop_prove(privkey);
+                // TODO: refactor pop
+                template<typename FakeAccumulator>
+                inline bool pop_verify(FakeAccumulator, const signature_type &proof) const {
+                    return bls_scheme_type::pop_verify(*pubkey, proof);
                 }
 
-                // FIXME: copy privkey between equivalent private keys is a bottleneck
-                // TODO: support using of the same privkey even if scheme policy differs in public params and scheme
-                //  type
+                /// the group element, the precomputed data and the validation flag are shared with the converted key,
+                /// so the conversion copies no group elements
                 template<typename ToPublicParams, template<typename> class ToBlsScheme>
-                operator private_key<bls<ToPublicParams, BlsVersion, ToBlsScheme, CurveType>>() const {
-                    return private_key<bls<ToPublicParams, BlsVersion, BlsScheme, CurveType>>(privkey);
+                operator public_key<bls<ToPublicParams, BlsVersion, ToBlsScheme, CurveType>>() const {
+                    return share<bls<ToPublicParams, BlsVersion, ToBlsScheme, CurveType>>();
                 }
 
             protected:
-                private_key_type privkey;
+                template<typename>
+                friend struct public_key;
+
+                public_key(const std::shared_ptr<const key_type> &pubkey,
+                           const std::shared_ptr<const prepared_public_key_type> &prepared, bool validated) :
+                    pubkey(pubkey), augmented_accumulator(augmented_slot()), prepared(prepared),
+                    validated(validated) {
+                }
+
+                /// accumulator with the serialized public key already buffered, built by the first signing or
+                /// verification with the key or any of its copies; the hashing module exposes no midstate, so the
+                /// prefix is still hashed together with every message when the digest is extracted
+                struct augmented_accumulator_slot {
+                    std::once_flag built;
+                    std::unique_ptr<const internal_accumulator_type> acc;
+                };
+
+                /// empty slot for the augmented accumulator if the scheme augments messages, nullptr otherwise
+                static inline std::shared_ptr<augmented_accumulator_slot> augmented_slot() {
+                    if (!bls_scheme_type::augments_messages) {
+                        return nullptr;
+                    }
+                    return std::make_shared<augmented_accumulator_slot>();
+                }
+
+                static inline std::unique_ptr<const internal_accumulator_type> augment(const key_type &pubkey) {
+                    std::unique_ptr<internal_accumulator_type> acc(new internal_accumulator_type());
+                    bls_scheme_type::init_accumulator(*acc, pubkey);
+                    return std::unique_ptr<const internal_accumulator_type>(std::move(acc));
+                }
+
+                /// the same key under another variant of the scheme with the same version and curve
+                template<typename ToScheme>
+                inline public_key<ToScheme> share() const {
+                    return public_key<ToScheme>(pubkey, prepared, validated);
+                }
+
+                // shared between copies and between variants of the scheme the key is converted to
+                std::shared_ptr<const public_key_type> pubkey;
+                // caches the serialized public key, which depends on the public params of the scheme, so it is shared
+                // between copies but not between variants, constructing or converting a key serializes nothing
+                std::shared_ptr<augmented_accumulator_slot> augmented_accumulator;
+                // shared between copies, so the key stays prepared when passed into accumulators by value
+                std::shared_ptr<const prepared_public_key_type> prepared;
+                // set once the key passed validation, so it is not repeated by every verification
+                bool validated = false;
             };
 
+            /*!
+             * @brief Public key with precomputed Miller loop lines of its group element, which are reused by every
+             * verification made with this key. Copies share the precomputed data.
+             */
             template<typename PublicParams, template<typename, typename> class BlsVersion,
                      template<typename> class BlsScheme, typename CurveType>
-            struct aggregate_op<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
+            struct prepared_public_key<bls<PublicParams, BlsVersion, BlsScheme, CurveType>>
+                : public public_key<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
                 typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
                 typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef public_key<scheme_type> base_type;
 
-                typedef typename bls_scheme_type::private_key_type private_key_type;
-                typedef typename bls_scheme_type::public_key_type public_key_type;
-                typedef typename bls_scheme_type::signature_type signature_type;
-
-                typedef signature_type internal_accumulator_type;
-                typedef signature_type result_type;
+                typedef typename base_type::public_key_type public_key_type;
+                typedef typename base_type::prepared_public_key_type prepared_public_key_type;
+                typedef typename bls_scheme_type::basic_functions::public_key_serialized_type
+                    public_key_serialized_type;
 
-                static inline void init_accumulator(internal_accumulator_type &acc) {
-                    acc = signature_type::zero();
-                }
+                typedef typename base_type::key_type key_type;
 
-                template<typename InputRange>
-                static inline void update(internal_accumulator_type &acc, const InputRange &range) {
-                    bls_scheme_type::update_aggregate(acc, range);
+                prepared_public_key() = delete;
+                prepared_public_key(const key_type &pubkey) : base_type(pubkey) {
+                    this->prepared =
+                        std::make_shared<const prepared_public_key_type>(bls_scheme_type::prepare_public_key(pubkey));
                 }
 
-                template<typename InputIterator>
-                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
-                    bls_scheme_type::update_aggregate(acc, first, last);
+                prepared_public_key(const base_type &pubkey) : base_type(pubkey) {
+                    if (!this->prepared) {
+                        this->prepared = std::make_shared<const prepared_public_key_type>(
+                            bls_scheme_type::prepare_public_key(*this->pubkey));
+                    }
                 }
 
-                static inline result_type process(internal_accumulator_type &acc) {
-                    return acc;
+                static inline public_key_serialized_type serialize(const key_type &pubkey) {
+                    return bls_scheme_type::basic_functions::point_to_pubkey(pubkey);
                 }
             };
 
+            /*!
+             * @brief Public key validated once on construction (KeyValidate of the specification, including the
+             * subgroup check), verifications made with this key skip the validation. Throws std::invalid_argument if
+             * the key is invalid.
+             */
             template<typename PublicParams, template<typename, typename> class BlsVersion,
                      template<typename> class BlsScheme, typename CurveType>
-            struct aggregate_verify_op<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
+            struct validated_public_key<bls<PublicParams, BlsVersion, BlsScheme, CurveType>>
+                : public public_key<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
                 typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
                 typedef typename scheme_type::bls_scheme_type bls_scheme_type;
-                typedef public_key<scheme_type> scheme_public_key_type;
+                typedef public_key<scheme_type> base_type;
 
-                typedef typename bls_scheme_type::private_key_type private_key_type;
-                typedef typename bls_scheme_type::public_key_type public_key_type;
-                typedef typename bls_scheme_type::signature_type signature_type;
+                typedef typename base_type::public_key_type public_key_type;
+                typedef typename base_type::key_type key_type;
+
+                validated_public_key() = delete;
+                validated_public_key(const key_type &pubkey) : base_type(pubkey) {
+                    validate();
+                }
+
+                validated_public_key(const base_type &pubkey) : base_type(pubkey) {
+                    validate();
+                }
+
+            private:
+                inline void validate() {
+                    if (!this->validated && !bls_scheme_type::basic_functions::validate_public_key(*this->pubkey)) {
+                        throw std::invalid_argument("BLS: invalid public key");
+                    }
+                    this->validated = true;
+                }
+            };
+
+            /*!
+             * @brief Registry of public keys with verified proofs of possession. Keys are registered with their
+             * proofs and verified in batches by verify_pending, only the keys which passed are kept. Passed as a
+             * sample to aggregate verification of a single message, the registry makes it reject signers outside the
+             * registry, the registry should outlive the accumulator then.
+             */
+            template<typename PublicParams, template<typename, typename> class BlsVersion, typename CurveType>
+            struct pop_registry<bls<PublicParams, BlsVersion, bls_pop_scheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, bls_pop_scheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef public_key<scheme_type> scheme_public_key_type;
+
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+                typedef typename bls_scheme_type::public_key_set_type public_key_set_type;
+                typedef typename bls_scheme_type::basic_functions::scalar_field_type scalar_field_type;
+
+                /// queue \p pubkey with its proof of possession, the key is accepted after verify_pending
+                inline void register_key(const scheme_public_key_type &pubkey, const signature_type &proof) {
+                    pending_keys.push_back(pubkey.public_key_data());
+                    pending_proofs.push_back(proof);
+                }
+
+                /// check proofs of all the queued keys at once, return the number of rejected keys
+                template<typename Generator = random::algebraic_random_device<scalar_field_type>>
+                inline std::size_t verify_pending() {
+                    std::vector<bool> results;
+                    results.reserve(std::size(pending_keys));
+                    bls_scheme_type::template pop_batch_verify<Generator>(
+                        std::cbegin(pending_keys), std::cend(pending_keys), std::cbegin(pending_proofs),
+                        std::back_inserter(results));
+
+                    std::size_t rejected = 0;
+                    for (std::size_t i = 0; i < std::size(results); ++i) {
+                        if (results[i]) {
+                            keys.insert(bls_scheme_type::basic_functions::point_to_pubkey(pending_keys[i]));
+                        } else {
+                            ++rejected;
+                        }
+                    }
+                    pending_keys.clear();
+                    pending_proofs.clear();
+                    return rejected;
+                }
+
+                inline bool contains(const scheme_public_key_type &pubkey) const {
+                    return keys.count(bls_scheme_type::basic_functions::point_to_pubkey(pubkey.public_key_data())) !=
+                           0;
+                }
+
+                inline std::size_t size() const {
+                    return std::size(keys);
+                }
+
+                inline std::size_t pending() const {
+                    return std::size(pending_keys);
+                }
+
+                inline const public_key_set_type &verified_keys() const {
+                    return keys;
+                }
+
+            private:
+                std::vector<public_key_type> pending_keys;
+                std::vector<signature_type> pending_proofs;
+                public_key_set_type keys;
+            };
+
+            /*!
+             * @brief Committee of validated public keys stored contiguously together with their sum. An aggregate
+             * signature of the committee is verified against a participation bitfield, a range of flags convertible
+             * to bool indexed as the keys, with a single pairing check. Keys are validated on construction, throws
+             * std::invalid_argument if some key is invalid.
+             */
+            template<typename PublicParams, template<typename, typename> class BlsVersion, typename CurveType>
+            struct validator_registry<bls<PublicParams, BlsVersion, bls_pop_scheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, bls_pop_scheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef typename bls_scheme_type::basic_functions basic_functions;
+                typedef public_key<scheme_type> scheme_public_key_type;
+
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+                typedef typename bls_scheme_type::internal_accumulator_type internal_accumulator_type;
+                typedef typename basic_functions::prepared_message_type prepared_message_type;
+
+                validator_registry() = delete;
+                template<typename PublicKeyRange>
+                validator_registry(const PublicKeyRange &pubkeys) : total(public_key_type::zero()) {
+                    for (const scheme_public_key_type &pubkey : pubkeys) {
+                        if (!pubkey.is_validated() && !basic_functions::validate_public_key(pubkey.public_key_data())) {
+                            throw std::invalid_argument("BLS: invalid public key");
+                        }
+                        keys.push_back(pubkey.public_key_data());
+                        total = total + keys.back();
+                    }
+                }
+
+                /// sum of the keys of the participants, the absent keys are subtracted from the total if most of
+                /// the committee participates
+                template<typename ParticipationRange>
+                inline public_key_type aggregate_public_key(const ParticipationRange &participation) const {
+                    BOOST_ASSERT(std::size(participation) == std::size(keys));
+                    return basic_functions::aggregate_participants(std::cbegin(keys), std::cend(keys), total,
+                                                                   std::cbegin(participation));
+                }
+
+                /// verify \p sig aggregated by the participants over \p msg, false if the bitfield does not match
+                /// the committee size or nobody participated
+                template<typename MsgRange, typename ParticipationRange>
+                inline bool aggregate_verify(const MsgRange &msg, const ParticipationRange &participation,
+                                             const signature_type &sig) const {
+                    if (std::size(participation) != std::size(keys)) {
+                        return false;
+                    }
+                    const public_key_type aggregated_key = aggregate_public_key(participation);
+                    if (aggregated_key.is_zero()) {
+                        return false;
+                    }
+                    internal_accumulator_type acc;
+                    bls_scheme_type::update(acc, msg);
+                    return basic_functions::verify_validated(acc, aggregated_key, sig);
+                }
+
+                /// the same for a message hashed beforehand, e.g. taken from hashed_message_cache
+                template<typename ParticipationRange>
+                inline bool aggregate_verify(const prepared_message_type &msg, const ParticipationRange &participation,
+                                             const signature_type &sig) const {
+                    if (std::size(participation) != std::size(keys)) {
+                        return false;
+                    }
+                    const public_key_type aggregated_key = aggregate_public_key(participation);
+                    if (aggregated_key.is_zero()) {
+                        return false;
+                    }
+                    return basic_functions::verify_validated(msg, aggregated_key, sig);
+                }
+
+                inline std::size_t size() const {
+                    return std::size(keys);
+                }
+
+                inline const public_key_type &operator[](std::size_t index) const {
+                    return keys[index];
+                }
+
+                inline const std::vector<public_key_type> &public_keys() const {
+                    return keys;
+                }
+
+                inline const public_key_type &total_public_key() const {
+                    return total;
+                }
+
+            private:
+                std::vector<public_key_type> keys;
+                public_key_type total;
+            };
+
+            template<typename PublicParams, template<typename, typename> class BlsVersion,
+                     template<typename> class BlsScheme, typename CurveType>
+            struct private_key<bls<PublicParams, BlsVersion, BlsScheme, CurveType>>
+                : public public_key<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef public_key<scheme_type> base_type;
+
+                typedef typename base_type::private_key_type private_key_type;
+                typedef typename base_type::public_key_type public_key_type;
+                typedef typename base_type::signature_type signature_type;
+
+                typedef typename bls_scheme_type::internal_accumulator_type internal_accumulator_type;
+
+                typedef private_key_type key_type;
+
+                private_key() = delete;
+                private_key(const key_type &privkey) :
+                    base_type(bls_scheme_type::generate_public_key(privkey)), privkey(privkey) {
+                    // derived from the private key, so valid by construction
+                    this->validated = true;
+                }
+
+                /// starts from the accumulator of the public part, so the aug scheme neither derives nor serializes
+                /// the public key again for every message
+                inline void init_accumulator(internal_accumulator_type &acc) const {
+                    base_type::init_accumulator(acc);
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, const InputRange &range) {
+                    bls_scheme_type::update(acc, range);
+                }
+
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    bls_scheme_type::update(acc, first, last);
+                }
+
+                inline signature_type sign(internal_accumulator_type &acc) const {
+                    return bls_scheme_type::sign(acc, privkey);
+                }
+
+                inline signature_type pop_prove() const {
+                    return bls_scheme_type::pop_prove(privkey);
+                }
+
+                /// the public part is shared with the converted key as for public_key, so the public key is not
+                /// derived from the private one again
+                template<typename ToPublicParams, template<typename> class ToBlsScheme>
+                operator private_key<bls<ToPublicParams, BlsVersion, ToBlsScheme, CurveType>>() const {
+                    typedef bls<ToPublicParams, BlsVersion, ToBlsScheme, CurveType> to_scheme_type;
+                    return private_key<to_scheme_type>(privkey, this->template share<to_scheme_type>());
+                }
+
+            protected:
+                template<typename>
+                friend struct private_key;
+
+                private_key(const key_type &privkey, const base_type &pubkey) : base_type(pubkey), privkey(privkey) {
+                }
+
+                private_key_type privkey;
+            };
+
+            template<typename PublicParams, template<typename, typename> class BlsVersion,
+                     template<typename> class BlsScheme, typename CurveType>
+            struct aggregate_op<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+
+                typedef typename bls_scheme_type::private_key_type private_key_type;
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+
+                typedef signature_type internal_accumulator_type;
+                typedef signature_type result_type;
+
+                static inline void init_accumulator(internal_accumulator_type &acc) {
+                    acc = signature_type::zero();
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, const InputRange &range) {
+                    bls_scheme_type::update_aggregate(acc, range);
+                }
+
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    bls_scheme_type::update_aggregate(acc, first, last);
+                }
+
+                template<typename Executor, typename InputRange>
+                static inline void update(internal_accumulator_type &acc, const InputRange &range) {
+                    bls_scheme_type::template update_aggregate<Executor>(acc, range);
+                }
+
+                template<typename Executor, typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    bls_scheme_type::template update_aggregate<Executor>(acc, first, last);
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    return acc;
+                }
+            };
+
+            /// Signatures of the multisignature scheme are aggregated together with the keys that made them, as
+            /// the key aggregation coefficients depend on the whole set of signers.
+            template<typename PublicParams, template<typename, typename> class BlsVersion, typename CurveType>
+            struct aggregate_op<bls<PublicParams, BlsVersion, bls_msp_scheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, bls_msp_scheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+
+                typedef typename bls_scheme_type::private_key_type private_key_type;
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+
+                /// signature together with the public key of its signer
+                typedef std::pair<public_key_type, signature_type> keyed_signature_type;
+
+                typedef typename bls_scheme_type::internal_keyed_aggregation_accumulator_type
+                    internal_accumulator_type;
+                typedef signature_type result_type;
+
+                static inline void init_accumulator(internal_accumulator_type &acc) {
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, const InputRange &range) {
+                    update(acc, std::cbegin(range), std::cend(range));
+                }
+
+                /// a signer passed again is skipped, the verifier takes every signer once as well
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    for (; first != last; ++first) {
+                        const keyed_signature_type &keyed_sig = *first;
+                        bls_scheme_type::add_signature(acc, keyed_sig.first, keyed_sig.second);
+                    }
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    return bls_scheme_type::aggregate_signatures(acc.first, acc.second);
+                }
+            };
+
+            template<typename PublicParams, template<typename, typename> class BlsVersion,
+                     template<typename> class BlsScheme, typename CurveType>
+            struct aggregate_verify_op<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef public_key<scheme_type> scheme_public_key_type;
+
+                typedef typename bls_scheme_type::private_key_type private_key_type;
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
 
                 typedef typename bls_scheme_type::internal_accumulator_type _internal_accumulator_type;
                 typedef typename bls_scheme_type::internal_aggregation_accumulator_type
                     _internal_aggregation_accumulator_type;
                 typedef _internal_aggregation_accumulator_type internal_accumulator_type;
+                typedef typename bls_scheme_type::basic_functions::prepared_message_type prepared_message_type;
                 typedef bool result_type;
 
                 static inline void init_accumulator(internal_accumulator_type &acc) {
                 }
 
+                /// every update is a whole message of the signer, in the serial mode it is hashed to the curve right
+                /// away, so only the point is kept until verification
                 template<typename InputIterator>
                 static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
                                           InputIterator first, InputIterator last) {
-                    auto index = get_public_key_index(acc, scheme_pubkey);
-                    bls_scheme_type::update(acc.second[index], first, last);
+                    append_message(acc, scheme_pubkey, bls_scheme_type::basic_functions::hash_to_point(
+                                                           scheme_pubkey.absorb_message(first, last)));
                 }
 
                 template<typename InputRange>
                 static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
                                           const InputRange &range) {
-                    auto index = get_public_key_index(acc, scheme_pubkey);
-                    bls_scheme_type::update(acc.second[index], range);
+                    append_message(acc, scheme_pubkey, bls_scheme_type::basic_functions::hash_to_point(
+                                                           scheme_pubkey.absorb_message(range)));
+                }
+
+                /// append a message hashed beforehand, e.g. taken from hashed_message_cache
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
+                                          const prepared_message_type &msg) {
+                    static_assert(!bls_scheme_type::augments_messages,
+                                  "hashed messages depend on the public key in the message augmentation scheme");
+                    append_message(acc, scheme_pubkey, msg.first);
+                }
+
+                /// the same as above, but the message is hashed together with the next ones once
+                /// basic_functions::deferred_messages_limit of them are collected, across the workers of Executor
+                template<typename Executor, typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
+                                          InputIterator first, InputIterator last) {
+                    defer_message<Executor>(acc, scheme_pubkey, scheme_pubkey.absorb_message(first, last));
+                }
+
+                template<typename Executor, typename InputRange>
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
+                                          const InputRange &range) {
+                    defer_message<Executor>(acc, scheme_pubkey, scheme_pubkey.absorb_message(range));
+                }
+
+                template<typename Executor>
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
+                                          const prepared_message_type &msg) {
+                    update(acc, scheme_pubkey, msg);
                 }
 
                 static inline result_type process(internal_accumulator_type &acc, const signature_type &sig) {
+                    assert(acc.deferred_messages.empty());
                     return bls_scheme_type::aggregate_verify(acc, sig);
                 }
 
+                template<typename Executor>
+                static inline result_type process(internal_accumulator_type &acc, const signature_type &sig) {
+                    bls_scheme_type::basic_functions::template hash_deferred_messages<Executor>(acc);
+                    return bls_scheme_type::template aggregate_verify<Executor>(acc, sig);
+                }
+
             private:
                 static inline std::size_t get_public_key_index(internal_accumulator_type &acc,
                                                                const scheme_public_key_type &scheme_pubkey) {
                     assert(std::distance(std::cbegin(acc.first), std::cend(acc.first)) ==
                            std::distance(std::cbegin(acc.second), std::cend(acc.second)));
 
-                    auto found_pos_it =
-                        std::find(std::cbegin(acc.first), std::cend(acc.first), scheme_pubkey.public_key_data());
+                    auto inserted = acc.index.emplace(
+                        bls_scheme_type::basic_functions::point_to_pubkey(scheme_pubkey.public_key_data()),
+                        std::size(acc.first));
 
-                    if (std::cend(acc.first) == found_pos_it) {
+                    if (inserted.second) {
                         acc.first.push_back(scheme_pubkey.public_key_data());
-                        acc.second.push_back(_internal_accumulator_type());
-                        bls_scheme_type::init_accumulator(acc.second.back(), acc.first.back());
-                        return std::size(acc.first) - 1;
+                        acc.second.emplace_back();
+                        if (!scheme_pubkey.is_validated() &&
+                            !bls_scheme_type::basic_functions::validate_public_key(acc.first.back())) {
+                            acc.invalid_public_key = true;
+                        }
                     }
 
-                    return std::distance(std::cbegin(acc.first), found_pos_it);
+                    return inserted.first->second;
+                }
+
+                static inline void append_message(internal_accumulator_type &acc,
+                                                  const scheme_public_key_type &scheme_pubkey,
+                                                  const signature_type &msg_point) {
+                    acc.second[get_public_key_index(acc, scheme_pubkey)].push_back(msg_point);
+                }
+
+                template<typename Executor>
+                static inline void defer_message(internal_accumulator_type &acc,
+                                                 const scheme_public_key_type &scheme_pubkey,
+                                                 const _internal_accumulator_type &msg_acc) {
+                    acc.deferred_messages.emplace_back(get_public_key_index(acc, scheme_pubkey), msg_acc);
+                    if (std::size(acc.deferred_messages) >= bls_scheme_type::basic_functions::deferred_messages_limit) {
+                        bls_scheme_type::basic_functions::template hash_deferred_messages<Executor>(acc);
+                    }
+                }
+            };
+
+            /// Aggregate verification with the Miller loop of every (pk, message) pair computed when the pair is
+            /// passed, so the result only takes the Miller loop of the signature and the final exponentiation. Messages
+            /// of the same signer are not grouped, each pair takes its own Miller loop.
+            template<typename PublicParams, template<typename, typename> class BlsVersion,
+                     template<typename> class BlsScheme, typename CurveType>
+            struct pipelined_aggregate_verify_op<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef typename bls_scheme_type::basic_functions basic_functions;
+                typedef public_key<scheme_type> scheme_public_key_type;
+
+                typedef typename bls_scheme_type::private_key_type private_key_type;
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+
+                typedef typename bls_scheme_type::internal_accumulator_type _internal_accumulator_type;
+                typedef typename basic_functions::internal_pipelined_aggregation_accumulator_type
+                    internal_accumulator_type;
+                typedef typename basic_functions::prepared_message_type prepared_message_type;
+                typedef bool result_type;
+
+                static inline void init_accumulator(internal_accumulator_type &acc) {
+                }
+
+                /// every update is a whole message of the signer, it is hashed to the curve and paired right away
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
+                                          InputIterator first, InputIterator last) {
+                    append_message(acc, scheme_pubkey,
+                                   basic_functions::hash_to_point(scheme_pubkey.absorb_message(first, last)));
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
+                                          const InputRange &range) {
+                    append_message(acc, scheme_pubkey,
+                                   basic_functions::hash_to_point(scheme_pubkey.absorb_message(range)));
+                }
+
+                /// append a message hashed beforehand, its precomputed lines are used for the Miller loop
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
+                                          const prepared_message_type &msg) {
+                    static_assert(!bls_scheme_type::augments_messages,
+                                  "hashed messages depend on the public key in the message augmentation scheme");
+                    append_message(acc, scheme_pubkey, msg.second);
+                }
+
+                static inline result_type process(internal_accumulator_type &acc, const signature_type &sig) {
+                    return basic_functions::aggregate_verify(acc, sig);
+                }
+
+            private:
+                template<typename MessageType>
+                static inline void append_message(internal_accumulator_type &acc,
+                                                  const scheme_public_key_type &scheme_pubkey, const MessageType &msg) {
+                    if (!scheme_pubkey.is_validated() &&
+                        !basic_functions::validate_public_key(scheme_pubkey.public_key_data())) {
+                        acc.invalid_public_key = true;
+                        return;
+                    }
+                    if (scheme_pubkey.is_prepared()) {
+                        basic_functions::update_miller_loops_product(acc, msg,
+                                                                     scheme_pubkey.prepared_public_key_data().second);
+                    } else {
+                        basic_functions::update_miller_loops_product(acc, msg, scheme_pubkey.public_key_data());
+                    }
+                }
+            };
+
+            template<typename PublicParams, template<typename, typename> class BlsVersion,
+                     template<typename> class BlsScheme, typename CurveType>
+            struct batch_verify_op<bls<PublicParams, BlsVersion, BlsScheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef public_key<scheme_type> scheme_public_key_type;
+
+                typedef typename bls_scheme_type::private_key_type private_key_type;
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+
+                typedef typename bls_scheme_type::internal_accumulator_type _internal_accumulator_type;
+                typedef typename bls_scheme_type::internal_batch_verification_accumulator_type
+                    _internal_batch_verification_accumulator_type;
+                typedef _internal_batch_verification_accumulator_type internal_accumulator_type;
+                typedef bool result_type;
+
+                static inline void init_accumulator(internal_accumulator_type &acc) {
+                }
+
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
+                                          InputIterator first, InputIterator last, const signature_type &sig) {
+                    bls_scheme_type::update(append_entry(acc, scheme_pubkey, sig), first, last);
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey,
+                                          const InputRange &range, const signature_type &sig) {
+                    bls_scheme_type::update(append_entry(acc, scheme_pubkey, sig), range);
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    return bls_scheme_type::batch_verify(acc);
+                }
+
+            private:
+                static inline _internal_accumulator_type &append_entry(internal_accumulator_type &acc,
+                                                                       const scheme_public_key_type &scheme_pubkey,
+                                                                       const signature_type &sig) {
+                    acc.emplace_back(scheme_pubkey.public_key_data(), _internal_accumulator_type(), sig);
+                    scheme_pubkey.init_accumulator(std::get<1>(acc.back()));
+                    return std::get<1>(acc.back());
+                }
+            };
+
+            /// Combination of partial signatures made with shares of a secret key dealt by \p SecretSharingScheme
+            /// into the signature of the secret key, sum lambda_i * sig_i with Lagrange coefficients lambda_i of the
+            /// quorum computed by a single multi-scalar multiplication. Partial signatures are indexed by the
+            /// participants, a participant is counted once. Coefficients of the quorum are taken from a cache if a
+            /// pointer to lagrange_coefficients_cache is passed to the accumulator.
+            template<typename PublicParams, template<typename, typename> class BlsVersion,
+                     template<typename> class BlsScheme, typename CurveType, typename SecretSharingScheme>
+            struct threshold_aggregate_op<bls<PublicParams, BlsVersion, BlsScheme, CurveType>, SecretSharingScheme> {
+                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef typename bls_scheme_type::basic_functions basic_functions;
+                typedef SecretSharingScheme secret_sharing_scheme_type;
+                typedef lagrange_coefficients_cache<secret_sharing_scheme_type> coefficients_cache_type;
+                typedef typename secret_sharing_scheme_type::indexes_type indexes_type;
+
+                typedef typename bls_scheme_type::private_key_type private_key_type;
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+                /// partial signature made with the share of the participant with the given index
+                typedef std::pair<std::size_t, signature_type> indexed_signature_type;
+
+                static_assert(!bls_scheme_type::augments_messages,
+                              "partial signatures of the message augmentation scheme sign different messages");
+
+                struct internal_accumulator_type {
+                    std::map<std::size_t, signature_type> partial_signatures;
+                    coefficients_cache_type *coefficients_cache = nullptr;
+                    std::size_t threshold_number = 0;
+                };
+                typedef signature_type result_type;
+
+                /// the accumulator is constructed with the threshold t of the sharing, fewer than t partial
+                /// signatures do not determine the signature
+                static inline void init_accumulator(internal_accumulator_type &acc, std::size_t threshold_number) {
+                    BOOST_ASSERT(secret_sharing_scheme_type::check_minimal_size(threshold_number));
+                    acc.threshold_number = threshold_number;
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, const InputRange &range) {
+                    update(acc, std::cbegin(range), std::cend(range));
+                }
+
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    for (auto iter = first; iter != last; ++iter) {
+                        update(acc, *iter);
+                    }
+                }
+
+                static inline void update(internal_accumulator_type &acc, const indexed_signature_type &partial) {
+                    acc.partial_signatures.emplace(partial);
+                }
+
+                static inline void update(internal_accumulator_type &acc, coefficients_cache_type *coefficients_cache) {
+                    acc.coefficients_cache = coefficients_cache;
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    if (std::size(acc.partial_signatures) < acc.threshold_number) {
+                        throw std::invalid_argument("BLS: not enough partial signatures");
+                    }
+
+                    indexes_type indexes;
+                    std::vector<signature_type> sigs;
+                    sigs.reserve(std::size(acc.partial_signatures));
+                    for (const auto &partial : acc.partial_signatures) {
+                        indexes.emplace_hint(std::end(indexes), partial.first);
+                        sigs.emplace_back(partial.second);
+                    }
+
+                    if (acc.coefficients_cache != nullptr) {
+                        return basic_functions::multi_scalar_multiplication(sigs,
+                                                                            *acc.coefficients_cache->get(indexes));
+                    }
+                    return basic_functions::multi_scalar_multiplication(
+                        sigs, secret_sharing_scheme_type::eval_basis_polys(indexes));
+                }
+
+                /// Check partial signatures of \p msg on the public shares of the signers before combining them, a
+                /// bool per partial signature is written to \p out. Public shares and partial signatures are given in
+                /// the same order, all of them are checked with a single pairing check unless some of them are invalid.
+                template<typename MsgRange, typename PublicShareRange, typename PartialSignatureRange,
+                         typename OutputIterator>
+                static inline OutputIterator verify_partial_signatures(const MsgRange &msg,
+                                                                       const PublicShareRange &public_shares,
+                                                                       const PartialSignatureRange &partials,
+                                                                       OutputIterator out) {
+                    std::vector<public_key_type> pks;
+                    for (const auto &public_share : public_shares) {
+                        pks.emplace_back(public_share.get_value());
+                    }
+                    std::vector<signature_type> sigs;
+                    for (const indexed_signature_type &partial : partials) {
+                        sigs.emplace_back(partial.second);
+                    }
+                    BOOST_ASSERT(std::size(pks) == std::size(sigs));
+
+                    typename bls_scheme_type::internal_accumulator_type acc;
+                    bls_scheme_type::update(acc, msg);
+                    return basic_functions::verify_single_msg(acc, pks, sigs, out);
+                }
+            };
+
+            /// Combination of partial signatures of the participants of weighted_shamir_sss. Every participant
+            /// collapses its parts into a share of the confirmed quorum with share_sss::to_shamir before signing, so
+            /// it makes a single partial signature whatever its weight is, and the Lagrange coefficients are already
+            /// applied in the scalar field. The partial signatures are summed then, once per participant.
+            template<typename PublicParams, template<typename, typename> class BlsVersion,
+                     template<typename> class BlsScheme, typename CurveType, typename Group>
+            struct threshold_aggregate_op<bls<PublicParams, BlsVersion, BlsScheme, CurveType>,
+                                          weighted_shamir_sss<Group>> {
+                typedef bls<PublicParams, BlsVersion, BlsScheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef typename bls_scheme_type::basic_functions basic_functions;
+                typedef weighted_shamir_sss<Group> secret_sharing_scheme_type;
+                typedef typename secret_sharing_scheme_type::coeffs_cache_type coefficients_cache_type;
+                typedef typename secret_sharing_scheme_type::indexes_type indexes_type;
+                typedef typename secret_sharing_scheme_type::weights_type weights_type;
+
+                typedef typename bls_scheme_type::private_key_type private_key_type;
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+                /// partial signature made with the collapsed share of the participant with the given index
+                typedef std::pair<std::size_t, signature_type> indexed_signature_type;
+
+                static_assert(!bls_scheme_type::augments_messages,
+                              "partial signatures of the message augmentation scheme sign different messages");
+
+                struct internal_accumulator_type {
+                    std::map<std::size_t, signature_type> partial_signatures;
+                    /// weights of the confirmed quorum the shares are collapsed to
+                    weights_type confirmed_weights;
+                    std::size_t threshold_number = 0;
+                };
+                typedef signature_type result_type;
+
+                /// the accumulator is constructed with the threshold t of the sharing, partial signatures of
+                /// participants holding fewer than t parts together do not determine the signature
+                static inline void init_accumulator(internal_accumulator_type &acc, std::size_t threshold_number) {
+                    BOOST_ASSERT(secret_sharing_scheme_type::check_minimal_size(threshold_number));
+                    acc.threshold_number = threshold_number;
+                }
+
+                template<typename InputRange>
+                static inline void update(internal_accumulator_type &acc, const InputRange &range) {
+                    update(acc, std::cbegin(range), std::cend(range));
+                }
+
+                template<typename InputIterator>
+                static inline void update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    for (auto iter = first; iter != last; ++iter) {
+                        update(acc, *iter);
+                    }
+                }
+
+                static inline void update(internal_accumulator_type &acc, const indexed_signature_type &partial) {
+                    acc.partial_signatures.emplace(partial);
+                }
+
+                /// weights of the quorum the partial signatures are made for, passed before the result is extracted
+                static inline void update(internal_accumulator_type &acc, const weights_type &confirmed_weights) {
+                    acc.confirmed_weights = confirmed_weights;
+                }
+
+                static inline result_type process(internal_accumulator_type &acc) {
+                    std::size_t total_weight = 0;
+                    std::vector<signature_type> sigs;
+                    sigs.reserve(std::size(acc.partial_signatures));
+                    for (const auto &partial : acc.partial_signatures) {
+                        auto weight_it = acc.confirmed_weights.find(partial.first);
+                        if (weight_it == std::cend(acc.confirmed_weights)) {
+                            throw std::invalid_argument("BLS: partial signature outside the confirmed quorum");
+                        }
+                        total_weight += weight_it->second;
+                        sigs.emplace_back(partial.second);
+                    }
+                    if (total_weight < acc.threshold_number) {
+                        throw std::invalid_argument("BLS: not enough partial signatures");
+                    }
+                    signature_type result = signature_type::zero();
+                    bls_scheme_type::update_aggregate(result, sigs);
+                    return result;
+                }
+
+                /// Check partial signatures of \p msg on the public shares of the participants collapsed to the
+                /// quorum \p confirmed_weights, a bool per partial signature is written to \p out. Public shares and
+                /// partial signatures are given in the same order. A public share is collapsed with a single
+                /// multi-scalar multiplication over its parts, coefficients of the quorum are taken from
+                /// \p coefficients_cache.
+                template<typename MsgRange, typename PublicShareRange, typename PartialSignatureRange,
+                         typename OutputIterator>
+                static inline OutputIterator verify_partial_signatures(const MsgRange &msg,
+                                                                       const PublicShareRange &public_shares,
+                                                                       const PartialSignatureRange &partials,
+                                                                       const weights_type &confirmed_weights,
+                                                                       coefficients_cache_type &coefficients_cache,
+                                                                       OutputIterator out) {
+                    std::vector<public_key_type> pks;
+                    if (std::cbegin(public_shares) != std::cend(public_shares)) {
+                        const indexes_type confirmed_indexes = secret_sharing_scheme_type::get_indexes(
+                            confirmed_weights, std::cbegin(public_shares)->get_threshold_number());
+                        const auto coeffs = coefficients_cache.get(confirmed_indexes);
+                        for (const auto &public_share : public_shares) {
+                            std::vector<public_key_type> parts;
+                            for (const auto &part : public_share.get_value()) {
+                                parts.emplace_back(part.get_value());
+                            }
+                            pks.emplace_back(basic_functions::multi_scalar_multiplication(
+                                parts, secret_sharing_scheme_type::get_part_coeffs(
+                                           confirmed_indexes, *coeffs, std::cbegin(public_share.get_value()),
+                                           std::cend(public_share.get_value()))));
+                        }
+                    }
+                    std::vector<signature_type> sigs;
+                    for (const indexed_signature_type &partial : partials) {
+                        sigs.emplace_back(partial.second);
+                    }
+                    BOOST_ASSERT(std::size(pks) == std::size(sigs));
+
+                    typename bls_scheme_type::internal_accumulator_type acc;
+                    bls_scheme_type::update(acc, msg);
+                    return basic_functions::verify_single_msg(acc, pks, sigs, out);
                 }
             };
 
@@ -606,13 +1738,86 @@ namespace nil {
                 }
 
                 static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey) {
-                    auto found_pos_it =
-                        std::find(std::cbegin(acc.first), std::cend(acc.first), scheme_pubkey.public_key_data());
-                    if (std::cend(acc.first) == found_pos_it) {
-                        acc.first.push_back(scheme_pubkey.public_key_data());
+                    bls_scheme_type::add_public_key(acc, scheme_pubkey.public_key_data(), scheme_pubkey.is_validated());
+                }
+
+                /// accept only signers registered in \p registry
+                static inline void update(internal_accumulator_type &acc, const pop_registry<scheme_type> &registry) {
+                    bls_scheme_type::restrict_public_keys(acc, registry.verified_keys());
+                }
+
+                static inline void exclude(internal_accumulator_type &acc,
+                                           const scheme_public_key_type &scheme_pubkey) {
+                    bls_scheme_type::remove_public_key(acc, scheme_pubkey.public_key_data());
+                }
+
+                static inline result_type process(internal_accumulator_type &acc, const signature_type &sig) {
+                    return bls_scheme_type::aggregate_verify(acc, sig);
+                }
+            };
+
+            template<typename PublicParams, template<typename, typename> class BlsVersion, typename CurveType>
+            struct aggregate_verify_single_msg_op<bls<PublicParams, BlsVersion, bls_msp_scheme, CurveType>> {
+                typedef bls<PublicParams, BlsVersion, bls_msp_scheme, CurveType> scheme_type;
+                typedef typename scheme_type::bls_scheme_type bls_scheme_type;
+                typedef public_key<scheme_type> scheme_public_key_type;
+
+                typedef typename bls_scheme_type::private_key_type private_key_type;
+                typedef typename bls_scheme_type::public_key_type public_key_type;
+                typedef typename bls_scheme_type::signature_type signature_type;
+
+                typedef typename bls_scheme_type::internal_accumulator_type _internal_accumulator_type;
+                typedef typename bls_scheme_type::internal_key_aggregation_accumulator_type
+                    _internal_key_aggregation_accumulator_type;
+                typedef _internal_key_aggregation_accumulator_type internal_accumulator_type;
+                typedef bool result_type;
+
+                static inline void init_accumulator(internal_accumulator_type &acc) {
+                }
+
+                template<typename InputIterator>
+                static inline typename std::enable_if<!std::is_convertible<
+                    typename std::iterator_traits<InputIterator>::value_type, scheme_public_key_type>::value>::type
+                    update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    bls_scheme_type::update(acc.second, first, last);
+                }
+
+                template<typename InputRange>
+                static inline typename std::enable_if<
+                    !std::is_convertible<typename std::iterator_traits<typename InputRange::iterator>::value_type,
+                                         scheme_public_key_type>::value>::type
+                    update(internal_accumulator_type &acc, const InputRange &range) {
+                    bls_scheme_type::update(acc.second, range);
+                }
+
+                template<typename InputIterator>
+                static inline typename std::enable_if<std::is_convertible<
+                    typename std::iterator_traits<InputIterator>::value_type, scheme_public_key_type>::value>::type
+                    update(internal_accumulator_type &acc, InputIterator first, InputIterator last) {
+                    for (auto iter = first; iter != last; ++iter) {
+                        update(acc, *iter);
+                    }
+                }
+
+                template<typename InputRange>
+                static inline typename std::enable_if<
+                    std::is_convertible<typename std::iterator_traits<typename InputRange::iterator>::value_type,
+                                        scheme_public_key_type>::value>::type
+                    update(internal_accumulator_type &acc, const InputRange &range) {
+                    for (const auto &scheme_pubkey : range) {
+                        update(acc, scheme_pubkey);
                     }
                 }
 
+                static inline void update(internal_accumulator_type &acc, const scheme_public_key_type &scheme_pubkey) {
+                    bls_scheme_type::add_public_key(acc, scheme_pubkey.public_key_data(), scheme_pubkey.is_validated());
+                }
+
+                static inline void exclude(internal_accumulator_type &acc,
+                                           const scheme_public_key_type &scheme_pubkey) {
+                    bls_scheme_type::remove_public_key(acc, scheme_pubkey.public_key_data());
+                }
+
                 static inline result_type process(internal_accumulator_type &acc, const signature_type &sig) {
                     return bls_scheme_type::aggregate_verify(acc, sig);
                 }
@@ -26,22 +26,36 @@
 #ifndef CRYPTO3_PUBKEY_BLS_CORE_FUNCTIONS_HPP
 #define CRYPTO3_PUBKEY_BLS_CORE_FUNCTIONS_HPP
 
+#include <cstdint>
 #include <utility>
 #include <vector>
 #include <array>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <type_traits>
 #include <iterator>
 #include <algorithm>
+#include <numeric>
+#include <exception>
+#include <random>
 
 #include <boost/assert.hpp>
 #include <boost/concept_check.hpp>
+#include <boost/container_hash/hash.hpp>
 
 #include <boost/range/concepts.hpp>
 
+#include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/algorithm/to_curve.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
+#include <nil/crypto3/pubkey/detail/thread_executor.hpp>
+
 #include <nil/crypto3/detail/type_traits.hpp>
 
 namespace nil {
@@ -51,21 +65,94 @@ namespace nil {
                 template<typename policy_type>
                 struct bls_basic_functions {
                     typedef typename policy_type::curve_type curve_type;
+                    typedef typename policy_type::scalar_field_type scalar_field_type;
+                    typedef typename scalar_field_type::integral_type integral_type;
                     typedef typename policy_type::gt_value_type gt_value_type;
                     typedef typename policy_type::private_key_type private_key_type;
                     typedef typename policy_type::public_key_type public_key_type;
                     typedef typename policy_type::signature_type signature_type;
+                    typedef typename policy_type::public_key_precomputed_type public_key_precomputed_type;
+                    typedef typename policy_type::signature_precomputed_type signature_precomputed_type;
                     typedef typename policy_type::h2c_policy h2c_policy;
+                    typedef typename policy_type::scalar_multiplication_policy scalar_multiplication_policy;
+                    typedef typename policy_type::secret_scalar_multiplication_policy
+                        secret_scalar_multiplication_policy;
+                    typedef typename policy_type::subgroup_check_policy subgroup_check_policy;
+
+                    typedef typename curve_type::base_field_type base_field_type;
+                    typedef typename base_field_type::value_type base_value_type;
+                    typedef typename base_field_type::integral_type base_integral_type;
 
                     typedef typename policy_type::bls_serializer bls_serializer;
                     typedef typename policy_type::public_key_serialized_type public_key_serialized_type;
                     typedef typename policy_type::signature_serialized_type signature_serialized_type;
 
                     typedef typename policy_type::internal_accumulator_type internal_accumulator_type;
-                    typedef std::pair<std::vector<public_key_type>, std::vector<internal_accumulator_type>>
-                        internal_aggregation_accumulator_type;
-                    typedef std::pair<std::vector<public_key_type>, internal_accumulator_type>
-                        internal_fast_aggregation_accumulator_type;
+                    /// signers and the messages signed by each of them, indexed by serialized public key for
+                    /// constant-time lookup of an already added signer, public keys are validated once when added.
+                    /// Messages are kept hashed to the curve, so the memory taken by a message does not depend on its
+                    /// size. Messages passed in the parallel mode are kept as accumulators together with the index of
+                    /// their signer until deferred_messages_limit of them are collected or verification starts, then
+                    /// they are hashed across the workers.
+                    struct internal_aggregation_accumulator_type
+                        : std::pair<std::vector<public_key_type>, std::vector<std::vector<signature_type>>> {
+                        std::unordered_map<public_key_serialized_type, std::size_t,
+                                           boost::hash<public_key_serialized_type>>
+                            index;
+                        std::vector<std::pair<std::size_t, internal_accumulator_type>> deferred_messages;
+                        bool invalid_public_key = false;
+                    };
+                    /// set of serialized public keys
+                    typedef std::unordered_set<public_key_serialized_type, boost::hash<public_key_serialized_type>>
+                        public_key_set_type;
+                    /// serialized public keys with the positions of the keys in a list of signers
+                    typedef std::unordered_map<public_key_serialized_type, std::size_t,
+                                               boost::hash<public_key_serialized_type>>
+                        public_key_index_type;
+                    /// running sum of the signers' public keys and the message accumulator, signers are remembered only
+                    /// by serialized public key to reject duplicates and to allow removing a key from the sum
+                    struct internal_fast_aggregation_accumulator_type
+                        : std::pair<public_key_type, internal_accumulator_type> {
+                        internal_fast_aggregation_accumulator_type() :
+                            std::pair<public_key_type, internal_accumulator_type>(public_key_type::zero(),
+                                                                                  internal_accumulator_type()) {
+                        }
+
+                        public_key_set_type signers;
+                        /// an added public key failed validation, the aggregate is rejected
+                        bool invalid_public_key = false;
+                        /// if set, only the keys of this set are accepted as signers
+                        const public_key_set_type *registered_keys = nullptr;
+                        /// a key outside registered_keys was added, the aggregate is rejected
+                        bool unregistered_key = false;
+                    };
+                    /// signers' public keys and the message accumulator, key aggregation coefficients depend on the
+                    /// whole set of signers, so the keys are combined only when the aggregate is verified
+                    struct internal_key_aggregation_accumulator_type
+                        : std::pair<std::vector<public_key_type>, internal_accumulator_type> {
+                        public_key_index_type signers;
+                        bool invalid_public_key = false;
+                    };
+                    /// signers' public keys and the signatures made with them, every signer is taken once as in the
+                    /// key aggregation accumulator, so the aggregated signature matches the aggregated key
+                    struct internal_keyed_aggregation_accumulator_type
+                        : std::pair<std::vector<public_key_type>, std::vector<signature_type>> {
+                        public_key_index_type signers;
+                    };
+                    /// running product of the Miller loops of the (pk, message) pairs passed so far, so only the final
+                    /// check is left when the aggregated signature is known
+                    struct internal_pipelined_aggregation_accumulator_type {
+                        gt_value_type miller_loops_product = gt_value_type::one();
+                        std::size_t pairs_number = 0;
+                        bool invalid_public_key = false;
+                    };
+                    typedef std::vector<std::tuple<public_key_type, internal_accumulator_type, signature_type>>
+                        internal_batch_verification_accumulator_type;
+                    typedef std::pair<signature_type, public_key_type> pairing_argument_type;
+                    /// public key together with precomputed Miller loop lines of its group element
+                    typedef std::pair<public_key_type, public_key_precomputed_type> prepared_public_key_type;
+                    /// message hashed to the curve together with precomputed Miller loop lines of the point
+                    typedef std::pair<signature_type, signature_precomputed_type> prepared_message_type;
 
                     constexpr static const std::size_t private_key_bits = policy_type::private_key_bits;
                     constexpr static const std::size_t L = static_cast<std::size_t>((3 * private_key_bits) / 16) +
@@ -74,6 +161,33 @@ namespace nil {
                     constexpr static const std::array<std::uint8_t, 2> L_os = {static_cast<std::uint8_t>(L >> 8u),
                                                                                static_cast<std::uint8_t>(L % 0x100)};
 
+                    /// number of octets of a compressed base field element
+                    constexpr static const std::size_t base_field_octets = (base_field_type::modulus_bits + 7) / 8;
+                    constexpr static const std::size_t public_key_coordinate_arity =
+                        std::is_same<typename public_key_type::field_type::value_type, base_value_type>::value ? 1 : 2;
+                    constexpr static const std::size_t signature_coordinate_arity =
+                        std::is_same<typename signature_type::field_type::value_type, base_value_type>::value ? 1 : 2;
+
+                    /// number of signatures starting from which aggregation normalizes them to affine coordinates
+                    constexpr static const std::size_t bulk_aggregation_threshold = 64;
+                    /// number of random subset sums a batch of signatures is checked with, a signature outside the
+                    /// subgroup passes each of them with probability at most 1/2
+                    constexpr static const std::size_t batch_subgroup_check_rounds = 64;
+                    /// number of messages the parallel aggregate verification keeps unhashed, reaching it hashes them
+                    /// across the workers, so the memory taken does not grow with the number of messages
+                    constexpr static const std::size_t deferred_messages_limit = 256;
+                    /// number of signatures starting from which the subset sums are cheaper than a subgroup check per
+                    /// signature, about 32 additions per signature against the multiplication by z of the check
+                    constexpr static const std::size_t batch_subgroup_check_threshold = 128;
+
+                    typedef hashes::sha2<256> key_aggregation_hash_type;
+                    /// number of bits of the key aggregation coefficients
+                    constexpr static const std::size_t key_aggregation_coefficient_bits = 128;
+                    /// "BLS_MSP_KEY_AGGREGATION_", domain separation tag of the key aggregation coefficients
+                    constexpr static const std::array<std::uint8_t, 24> key_aggregation_dst = {
+                        0x42, 0x4c, 0x53, 0x5f, 0x4d, 0x53, 0x50, 0x5f, 0x4b, 0x45, 0x59, 0x5f,
+                        0x41, 0x47, 0x47, 0x52, 0x45, 0x47, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f};
+
                     // TODO: implement key_gen
                     // template<typename IkmType, typename KeyInfoType>
                     // static inline private_key_type key_gen(const IkmType &ikm, const KeyInfoType &key_info) {}
@@ -85,11 +199,15 @@ namespace nil {
                     static inline public_key_type privkey_to_pubkey(const private_key_type &sk) {
                         BOOST_ASSERT(validate_private_key(sk));
 
-                        return sk * public_key_type::one();
+                        return secret_scalar_multiplication_policy::multiply(sk, public_key_type::one());
                     }
 
                     static inline bool validate_public_key(const public_key_type &pk) {
-                        return !(pk.is_zero() || !pk.is_well_formed());
+                        return !(pk.is_zero() || !pk.is_well_formed() || !subgroup_check_policy::is_in_subgroup(pk));
+                    }
+
+                    static inline bool validate_signature(const signature_type &sig) {
+                        return sig.is_well_formed() && subgroup_check_policy::is_in_subgroup(sig);
                     }
 
                     template<typename InputRange>
@@ -111,22 +229,94 @@ namespace nil {
                         BOOST_ASSERT(validate_private_key(sk));
 
                         signature_type Q = hashes::accumulators::extract::to_curve<h2c_policy>(acc);
-                        return sk * Q;
+                        return secret_scalar_multiplication_policy::multiply(sk, Q);
                     }
 
                     static inline bool verify(const internal_accumulator_type &acc, const public_key_type &pk,
                                               const signature_type &sig) {
-                        /// check if signature point is on the curve
-                        if (!sig.is_well_formed()) {
+                        if (!validate_public_key(pk)) {
                             return false;
                         }
-                        if (!validate_public_key(pk)) {
+                        return verify_validated(acc, pk, sig);
+                    }
+
+                    /// the same as verify, but \p pk is known to pass validate_public_key
+                    static inline bool verify_validated(const internal_accumulator_type &acc,
+                                                        const public_key_type &pk, const signature_type &sig) {
+                        /// check if signature point is on the curve and in the subgroup
+                        if (!validate_signature(sig)) {
+                            return false;
+                        }
+                        signature_type Q = hashes::accumulators::extract::to_curve<h2c_policy>(acc);
+                        return check_pairing_product(policy_type::miller_loop(Q, pk), sig);
+                    }
+
+                    static inline prepared_public_key_type prepare_public_key(const public_key_type &pk) {
+                        return prepared_public_key_type(pk, policy_type::precompute_public_key(pk));
+                    }
+
+                    /// hash \p range to the curve as a message of the scheme without augmentation
+                    template<typename InputRange>
+                    static inline prepared_message_type hash_message(const InputRange &range) {
+                        internal_accumulator_type acc;
+                        update(acc, range);
+                        signature_type Q = hash_to_point(acc);
+                        return prepared_message_type(Q, policy_type::precompute_signature(Q));
+                    }
+
+                    static inline signature_type hash_to_point(const internal_accumulator_type &acc) {
+                        return hashes::accumulators::extract::to_curve<h2c_policy>(acc);
+                    }
+
+                    static inline bool verify(const internal_accumulator_type &acc, const prepared_public_key_type &pk,
+                                              const signature_type &sig) {
+                        if (!validate_public_key(pk.first)) {
+                            return false;
+                        }
+                        return verify_validated(acc, pk, sig);
+                    }
+
+                    static inline bool verify_validated(const internal_accumulator_type &acc,
+                                                        const prepared_public_key_type &pk, const signature_type &sig) {
+                        if (!validate_signature(sig)) {
                             return false;
                         }
                         signature_type Q = hashes::accumulators::extract::to_curve<h2c_policy>(acc);
-                        auto C1 = policy_type::pairing(Q, pk);
-                        auto C2 = policy_type::pairing(sig, public_key_type::one());
-                        return C1 == C2;
+                        return check_pairing_product(policy_type::miller_loop(Q, pk.second), sig);
+                    }
+
+                    /// verification of a message hashed beforehand by hash_message, the lines of the hashed message
+                    /// are precomputed as well
+                    static inline bool verify(const prepared_message_type &msg, const public_key_type &pk,
+                                              const signature_type &sig) {
+                        if (!validate_public_key(pk)) {
+                            return false;
+                        }
+                        return verify_validated(msg, pk, sig);
+                    }
+
+                    static inline bool verify_validated(const prepared_message_type &msg, const public_key_type &pk,
+                                                        const signature_type &sig) {
+                        if (!validate_signature(sig)) {
+                            return false;
+                        }
+                        return check_pairing_product(policy_type::miller_loop(msg.second, pk), sig);
+                    }
+
+                    static inline bool verify(const prepared_message_type &msg, const prepared_public_key_type &pk,
+                                              const signature_type &sig) {
+                        if (!validate_public_key(pk.first)) {
+                            return false;
+                        }
+                        return verify_validated(msg, pk, sig);
+                    }
+
+                    static inline bool verify_validated(const prepared_message_type &msg,
+                                                        const prepared_public_key_type &pk, const signature_type &sig) {
+                        if (!validate_signature(sig)) {
+                            return false;
+                        }
+                        return check_pairing_product(policy_type::miller_loop(msg.second, pk.second), sig);
                     }
 
                     template<
@@ -136,14 +326,59 @@ namespace nil {
                     static inline void aggregate(signature_type &acc, SignatureIterator sig_first,
                                                  SignatureIterator sig_last) {
                         BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<SignatureIterator>));
-                        assert(std::distance(sig_first, sig_last) > 0);
+                        const auto sigs_number = std::distance(sig_first, sig_last);
+                        assert(sigs_number > 0);
 
+                        if (static_cast<std::size_t>(sigs_number) >= bulk_aggregation_threshold) {
+                            std::vector<signature_type> sigs(sig_first, sig_last);
+                            acc = acc + sum_normalized(sigs, 0, std::size(sigs));
+                            return;
+                        }
                         while (sig_first != sig_last) {
                             signature_type next_p = *sig_first++;
                             acc = acc + next_p;
                         }
                     }
 
+                    /// The same as above, but large ranges are split into Executor::concurrency() parts summed in
+                    /// parallel, partial sums are then reduced pairwise.
+                    template<
+                        typename Executor, typename SignatureIterator,
+                        typename = typename std::enable_if<std::is_same<
+                            signature_type, typename std::iterator_traits<SignatureIterator>::value_type>::value>::type>
+                    static inline void aggregate(signature_type &acc, SignatureIterator sig_first,
+                                                 SignatureIterator sig_last) {
+                        BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<SignatureIterator>));
+                        assert(std::distance(sig_first, sig_last) > 0);
+
+                        std::vector<signature_type> sigs(sig_first, sig_last);
+                        const std::size_t n = std::size(sigs);
+                        const std::size_t parts_number = std::max<std::size_t>(
+                            1, std::min(Executor::concurrency(), n / bulk_aggregation_threshold));
+                        std::vector<signature_type> partial_sums(parts_number);
+                        Executor::parallel_for(parts_number, [&](std::size_t part) {
+                            partial_sums[part] =
+                                sum_normalized(sigs, part * n / parts_number, (part + 1) * n / parts_number);
+                        });
+
+                        for (std::size_t stride = 1; stride < parts_number; stride *= 2) {
+                            for (std::size_t i = 0; i + stride < parts_number; i += 2 * stride) {
+                                partial_sums[i] = partial_sums[i] + partial_sums[i + stride];
+                            }
+                        }
+                        acc = acc + partial_sums.front();
+                    }
+
+                    template<typename Executor, typename SignatureRange,
+                             typename = typename std::enable_if<std::is_same<
+                                 signature_type, typename std::iterator_traits<
+                                                     typename SignatureRange::iterator>::value_type>::value>::type>
+                    static inline void aggregate(signature_type &acc, const SignatureRange &sig_n) {
+                        BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<SignatureRange>));
+
+                        aggregate<Executor>(acc, std::cbegin(sig_n), std::cend(sig_n));
+                    }
+
                     template<typename SignatureRange,
                              typename = typename std::enable_if<std::is_same<
                                  signature_type, typename std::iterator_traits<
@@ -156,61 +391,840 @@ namespace nil {
 
                     static inline bool aggregate_verify(const internal_aggregation_accumulator_type &acc,
                                                         const signature_type &sig) {
-                        const typename internal_aggregation_accumulator_type::first_type &pk_n = acc.first;
-                        const typename internal_aggregation_accumulator_type::second_type &acc_n = acc.second;
-                        assert(std::distance(pk_n.begin(), pk_n.end()) > 0 &&
-                               std::distance(pk_n.begin(), pk_n.end()) == std::distance(acc_n.begin(), acc_n.end()));
+                        assert(std::distance(acc.first.begin(), acc.first.end()) > 0 &&
+                               std::distance(acc.first.begin(), acc.first.end()) ==
+                                   std::distance(acc.second.begin(), acc.second.end()));
 
-                        if (!sig.is_well_formed()) {
+                        if (acc.invalid_public_key || !validate_signature(sig)) {
                             return false;
                         }
-                        auto pk_n_iter = std::cbegin(pk_n);
-                        auto acc_n_iter = std::cbegin(acc_n);
-                        gt_value_type C1 = gt_value_type::one();
-                        while (pk_n_iter != std::cend(pk_n) && acc_n_iter != std::cend(acc_n)) {
-                            if (!validate_public_key(*pk_n_iter)) {
-                                return false;
+                        gt_value_type f = gt_value_type::one();
+                        aggregate_miller_loop(acc, 0, std::size(acc.first), f);
+                        return check_pairing_product(f, sig);
+                    }
+
+                    /// The same as above, but the (pk, message) pairs are split into Executor::concurrency() parts,
+                    /// which are hashed and paired in parallel, partial products are combined before the final
+                    /// exponentiation.
+                    template<typename Executor>
+                    static inline bool aggregate_verify(const internal_aggregation_accumulator_type &acc,
+                                                        const signature_type &sig) {
+                        assert(std::distance(acc.first.begin(), acc.first.end()) > 0 &&
+                               std::distance(acc.first.begin(), acc.first.end()) ==
+                                   std::distance(acc.second.begin(), acc.second.end()));
+
+                        if (acc.invalid_public_key || !validate_signature(sig)) {
+                            return false;
+                        }
+                        const std::size_t n = std::size(acc.first);
+                        const std::size_t parts_number = std::max<std::size_t>(1, std::min(Executor::concurrency(), n));
+                        std::vector<gt_value_type> partial_products(parts_number, gt_value_type::one());
+                        Executor::parallel_for(parts_number, [&](std::size_t part) {
+                            aggregate_miller_loop(acc, part * n / parts_number, (part + 1) * n / parts_number,
+                                                  partial_products[part]);
+                        });
+
+                        gt_value_type f = gt_value_type::one();
+                        for (std::size_t part = 0; part < parts_number; ++part) {
+                            f = f * partial_products[part];
+                        }
+                        return check_pairing_product(f, sig);
+                    }
+
+                    /// Fold the Miller loop of a message hashed to the curve and the key of its signer into the running
+                    /// product of \p acc, the message and the key are either points or their precomputed lines.
+                    template<typename MessageType, typename PublicKeyType>
+                    static inline void update_miller_loops_product(internal_pipelined_aggregation_accumulator_type &acc,
+                                                                   const MessageType &msg, const PublicKeyType &pk) {
+                        acc.miller_loops_product = acc.miller_loops_product * policy_type::miller_loop(msg, pk);
+                        ++acc.pairs_number;
+                    }
+
+                    static inline bool aggregate_verify(const internal_pipelined_aggregation_accumulator_type &acc,
+                                                        const signature_type &sig) {
+                        assert(acc.pairs_number > 0 || acc.invalid_public_key);
+
+                        if (acc.invalid_public_key || !validate_signature(sig)) {
+                            return false;
+                        }
+                        return check_pairing_product(acc.miller_loops_product, sig);
+                    }
+
+                    /// hash the deferred messages of \p acc to the curve, split into Executor::concurrency() parts, and
+                    /// append the points to the messages of their signers
+                    template<typename Executor>
+                    static inline void hash_deferred_messages(internal_aggregation_accumulator_type &acc) {
+                        const std::size_t n = std::size(acc.deferred_messages);
+                        std::vector<signature_type> points(n);
+                        const std::size_t parts_number = std::max<std::size_t>(1, std::min(Executor::concurrency(), n));
+                        Executor::parallel_for(parts_number, [&](std::size_t part) {
+                            for (std::size_t i = part * n / parts_number; i < (part + 1) * n / parts_number; ++i) {
+                                points[i] = hash_to_point(acc.deferred_messages[i].second);
+                            }
+                        });
+
+                        for (std::size_t i = 0; i < n; ++i) {
+                            acc.second[acc.deferred_messages[i].first].push_back(points[i]);
+                        }
+                        acc.deferred_messages.clear();
+                    }
+
+                    /// Messages are hashed once and the pairing product is computed either per distinct message
+                    /// with summed public keys, e(H(m), pk_1 + ... + pk_k), or per distinct key with summed hashed
+                    /// messages, whichever takes less Miller loops. Summing the keys is only sound if the keys are
+                    /// protected against rogue key attacks, e.g. by proofs of possession.
+                    static inline bool aggregate_verify_by_message(const internal_aggregation_accumulator_type &acc,
+                                                                   const signature_type &sig) {
+                        assert(std::distance(acc.first.begin(), acc.first.end()) > 0 &&
+                               std::distance(acc.first.begin(), acc.first.end()) ==
+                                   std::distance(acc.second.begin(), acc.second.end()));
+
+                        if (acc.invalid_public_key || !validate_signature(sig)) {
+                            return false;
+                        }
+                        std::unordered_map<signature_serialized_type, std::size_t,
+                                           boost::hash<signature_serialized_type>>
+                            message_index;
+                        std::vector<pairing_argument_type> message_groups;
+                        std::vector<pairing_argument_type> key_groups;
+                        key_groups.reserve(std::size(acc.first));
+                        for (std::size_t i = 0; i < std::size(acc.first); ++i) {
+                            key_groups.emplace_back(signature_type::zero(), acc.first[i]);
+                            for (const signature_type &Q : acc.second[i]) {
+                                key_groups.back().first = key_groups.back().first + Q;
+
+                                auto inserted = message_index.emplace(point_to_signature(Q), std::size(message_groups));
+                                if (inserted.second) {
+                                    message_groups.emplace_back(Q, acc.first[i]);
+                                } else {
+                                    message_groups[inserted.first->second].second =
+                                        message_groups[inserted.first->second].second + acc.first[i];
+                                }
                             }
-                            signature_type Q = hashes::accumulators::extract::to_curve<h2c_policy>(*acc_n_iter++);
-                            C1 = C1 * policy_type::pairing(Q, *pk_n_iter++);
                         }
-                        return C1 == policy_type::pairing(sig, public_key_type::one());
+
+                        const std::vector<pairing_argument_type> &groups =
+                            std::size(message_groups) < std::size(key_groups) ? message_groups : key_groups;
+                        return check_pairing_product(
+                            policy_type::multi_miller_loop(std::cbegin(groups), std::cend(groups)), sig);
                     }
 
                     static inline bool aggregate_verify(const internal_fast_aggregation_accumulator_type &acc,
                                                         const signature_type &sig) {
-                        const typename internal_fast_aggregation_accumulator_type::first_type &pk_n = acc.first;
-                        const typename internal_fast_aggregation_accumulator_type::second_type &msg_acc = acc.second;
-                        assert(std::distance(pk_n.begin(), pk_n.end()) > 0);
+                        assert(!acc.signers.empty());
+
+                        if (acc.unregistered_key || acc.invalid_public_key) {
+                            return false;
+                        }
+                        return !acc.first.is_zero() && verify_validated(acc.second, acc.first, sig);
+                    }
+
+                    /// add \p pk to the aggregated public key unless it was already added, return false otherwise.
+                    /// A key not validated before is validated once when added, as validating only the sum would let
+                    /// components outside the subgroup of several keys cancel each other. If the accumulator is
+                    /// restricted to registered keys, a key outside the registry is not added and marks the aggregate
+                    /// as rejected, keys of the registry are treated as validated.
+                    static inline bool add_public_key(internal_fast_aggregation_accumulator_type &acc,
+                                                      const public_key_type &pk, bool validated = false) {
+                        public_key_serialized_type serialized_pk = point_to_pubkey(pk);
+                        if (acc.registered_keys != nullptr) {
+                            if (acc.registered_keys->count(serialized_pk) == 0) {
+                                acc.unregistered_key = true;
+                                return false;
+                            }
+                            validated = true;
+                        }
+                        if (!acc.signers.insert(serialized_pk).second) {
+                            return false;
+                        }
+                        if (!validated && !validate_public_key(pk)) {
+                            acc.invalid_public_key = true;
+                        }
+                        acc.first = acc.first + pk;
+                        return true;
+                    }
+
+                    /// Sum of the keys [first, last) for which the flag given by \p participation is set. If more than
+                    /// half of the keys participate, the absent keys are subtracted from \p total, the sum of all the
+                    /// keys, instead, so at most half of the keys are added either way.
+                    template<typename PublicKeyIterator, typename ParticipationIterator>
+                    static inline public_key_type
+                        aggregate_participants(PublicKeyIterator first, PublicKeyIterator last,
+                                               const public_key_type &total, ParticipationIterator participation) {
+                        const std::size_t keys_number = std::distance(first, last);
+                        std::size_t participants = 0;
+                        ParticipationIterator flag = participation;
+                        for (std::size_t i = 0; i < keys_number; ++i, ++flag) {
+                            participants += static_cast<bool>(*flag);
+                        }
+
+                        const bool subtract_absent = 2 * participants > keys_number;
+                        public_key_type result = subtract_absent ? total : public_key_type::zero();
+                        for (; first != last; ++first, ++participation) {
+                            if (static_cast<bool>(*participation) != subtract_absent) {
+                                result = subtract_absent ? result - *first : result + *first;
+                            }
+                        }
+                        return result;
+                    }
+
+                    /// restrict \p acc to the keys of \p registered_keys, signers added before are checked at once
+                    static inline void restrict_public_keys(internal_fast_aggregation_accumulator_type &acc,
+                                                            const public_key_set_type &registered_keys) {
+                        acc.registered_keys = &registered_keys;
+                        for (const auto &signer : acc.signers) {
+                            if (registered_keys.count(signer) == 0) {
+                                acc.unregistered_key = true;
+                                return;
+                            }
+                        }
+                    }
+
+                    /// remove \p pk from the aggregated public key if it was added, return false otherwise
+                    static inline bool remove_public_key(internal_fast_aggregation_accumulator_type &acc,
+                                                         const public_key_type &pk) {
+                        if (acc.signers.erase(point_to_pubkey(pk)) == 0) {
+                            return false;
+                        }
+                        acc.first = acc.first - pk;
+                        return true;
+                    }
+
+                    /// Every signature is weighted with a random scalar r_i and the whole batch is checked with
+                    /// prod e(r_i * H(m_i), pk_i) * e(-sum r_i * sig_i, g) == 1, which takes N + 1 Miller loops and
+                    /// a single final exponentiation.
+                    template<typename Generator = random::algebraic_random_device<scalar_field_type>>
+                    static inline bool batch_verify(const internal_batch_verification_accumulator_type &acc) {
+                        if (acc.empty()) {
+                            return false;
+                        }
+
+                        Generator gen;
+                        signature_type sig_combination = signature_type::zero();
+                        std::vector<pairing_argument_type> args;
+                        args.reserve(std::size(acc));
+                        for (const auto &entry : acc) {
+                            const public_key_type &pk = std::get<0>(entry);
+                            const signature_type &sig = std::get<2>(entry);
+                            if (!validate_signature(sig)) {
+                                return false;
+                            }
+                            if (!validate_public_key(pk)) {
+                                return false;
+                            }
+
+                            private_key_type r = gen();
+                            signature_type Q = hashes::accumulators::extract::to_curve<h2c_policy>(std::get<1>(entry));
+                            // the coefficients are not secret, so the faster variable time multiplication is used
+                            args.emplace_back(scalar_multiplication_policy::multiply(r, Q), pk);
+                            sig_combination = sig_combination + scalar_multiplication_policy::multiply(r, sig);
+                        }
+                        return check_pairing_product(policy_type::multi_miller_loop(std::cbegin(args), std::cend(args)),
+                                                     sig_combination);
+                    }
+
+                    /// Check every signature in [first, last) to be on the curve and in the subgroup, writing a result
+                    /// per signature to \p out. The range is split into Executor::concurrency() parts checked in
+                    /// parallel, the signatures on the curve of a part are checked together with batch_subgroup_check.
+                    template<typename Executor = thread_executor, typename SignatureIterator, typename OutputIterator>
+                    static inline OutputIterator validate_signatures(SignatureIterator first, SignatureIterator last,
+                                                                     OutputIterator out) {
+                        const std::vector<signature_type> sigs(first, last);
+                        const std::size_t n = std::size(sigs);
+                        std::vector<std::uint8_t> results(n, 0);
+                        const std::size_t parts_number = std::max<std::size_t>(1, std::min(Executor::concurrency(), n));
+                        Executor::parallel_for(parts_number, [&](std::size_t part) {
+                            std::vector<std::size_t> well_formed;
+                            for (std::size_t i = part * n / parts_number; i < (part + 1) * n / parts_number; ++i) {
+                                if (sigs[i].is_well_formed()) {
+                                    well_formed.push_back(i);
+                                }
+                            }
+                            batch_subgroup_check(sigs, well_formed, 0, std::size(well_formed), results);
+                        });
+
+                        for (std::uint8_t result : results) {
+                            *out++ = static_cast<bool>(result);
+                        }
+                        return out;
+                    }
+
+                    /// Set results[i] for the signatures sigs[i] on the curve with i in indexes[first, last) to whether
+                    /// sigs[i] is in the subgroup. A large range is checked with batch_subgroup_check_rounds random
+                    /// subset sums, one of which is outside the subgroup with probability at least 1/2 if some
+                    /// signature is, whatever the small order components are. Only if a sum fails the range is
+                    /// bisected, short ranges take a subgroup check per signature.
+                    static inline void batch_subgroup_check(const std::vector<signature_type> &sigs,
+                                                            const std::vector<std::size_t> &indexes, std::size_t first,
+                                                            std::size_t last, std::vector<std::uint8_t> &results) {
+                        if (last - first < batch_subgroup_check_threshold) {
+                            for (std::size_t i = first; i < last; ++i) {
+                                results[indexes[i]] = subgroup_check_policy::is_in_subgroup(sigs[indexes[i]]);
+                            }
+                            return;
+                        }
+
+                        std::random_device rd;
+                        std::vector<signature_type> sums(batch_subgroup_check_rounds, signature_type::zero());
+                        for (std::size_t i = first; i < last; ++i) {
+                            std::uint64_t subsets = (static_cast<std::uint64_t>(rd()) << 32u) | rd();
+                            for (std::size_t round = 0; subsets != 0; ++round, subsets >>= 1u) {
+                                if (subsets & 1u) {
+                                    sums[round] = sums[round] + sigs[indexes[i]];
+                                }
+                            }
+                        }
+                        if (std::all_of(std::cbegin(sums), std::cend(sums), [](const signature_type &sum) {
+                                return subgroup_check_policy::is_in_subgroup(sum);
+                            })) {
+                            for (std::size_t i = first; i < last; ++i) {
+                                results[indexes[i]] = 1;
+                            }
+                            return;
+                        }
+
+                        const std::size_t middle = first + (last - first) / 2;
+                        batch_subgroup_check(sigs, indexes, first, middle, results);
+                        batch_subgroup_check(sigs, indexes, middle, last, results);
+                    }
+
+                    /// Decode count compressed public keys stored back to back in data into points[0, count). valid[i]
+                    /// is set to whether the i-th octets encode a valid public key, invalid entries are left as zero
+                    /// and do not abort the batch. Parts of the buffer are decoded in parallel by Executor.
+                    template<typename Executor = thread_executor>
+                    static inline std::size_t pubkeys_from_octets(const std::uint8_t *data, std::size_t count,
+                                                                  public_key_type *points, bool *valid) {
+                        return points_from_octets<Executor, public_key_serialized_type>(
+                            data, count, points, valid, [](const public_key_serialized_type &octets) {
+                                return policy_type::octets_to_public_key(octets);
+                            },
+                            [](const public_key_type &pk) { return validate_public_key(pk); });
+                    }
+
+                    /// the same as pubkeys_from_octets for compressed signatures
+                    template<typename Executor = thread_executor>
+                    static inline std::size_t signatures_from_octets(const std::uint8_t *data, std::size_t count,
+                                                                     signature_type *points, bool *valid) {
+                        return points_from_octets<Executor, signature_serialized_type>(
+                            data, count, points, valid, [](const signature_serialized_type &octets) {
+                                return policy_type::octets_to_signature(octets);
+                            },
+                            [](const signature_type &sig) { return validate_signature(sig); });
+                    }
+
+                    /// Compress count public keys into out, which should hold count serialized public keys. All the
+                    /// keys are converted to affine coordinates with a single field inversion, so this is cheaper
+                    /// than point_to_pubkey per key.
+                    static inline void pubkeys_to_octets(const public_key_type *points, std::size_t count,
+                                                         std::uint8_t *out) {
+                        static_assert(std::tuple_size<public_key_serialized_type>::value ==
+                                          base_field_octets * public_key_coordinate_arity,
+                                      "unexpected size of serialized public key");
+                        points_to_octets(points, count, out);
+                    }
+
+                    /// the same as pubkeys_to_octets for signatures
+                    static inline void signatures_to_octets(const signature_type *points, std::size_t count,
+                                                            std::uint8_t *out) {
+                        static_assert(std::tuple_size<signature_serialized_type>::value ==
+                                          base_field_octets * signature_coordinate_arity,
+                                      "unexpected size of serialized signature");
+                        points_to_octets(points, count, out);
+                    }
+
+                    /// Multi-scalar multiplication sum scalars_i * points_i (Pippenger): scalars are split into windows
+                    /// of window_bits(n) bits, every point is added once per window to the bucket of its digit and the
+                    /// buckets are summed with running sums, so the doublings are shared by all the points.
+                    /// Only the lowest \p scalar_bits bits of the scalars are taken.
+                    template<typename PointType>
+                    static inline PointType
+                        multi_scalar_multiplication(const std::vector<PointType> &points,
+                                                    const std::vector<private_key_type> &scalars,
+                                                    std::size_t scalar_bits = private_key_bits) {
+                        assert(std::size(points) == std::size(scalars));
+
+                        const std::size_t window_bits = msm_window_bits(std::size(points));
+                        const std::size_t buckets_number = (std::size_t(1) << window_bits) - 1;
+                        const integral_type mask(buckets_number);
+
+                        std::vector<integral_type> digits;
+                        digits.reserve(std::size(scalars));
+                        for (const auto &scalar : scalars) {
+                            digits.emplace_back(static_cast<integral_type>(scalar.data));
+                        }
+
+                        PointType result = PointType::zero();
+                        std::vector<PointType> buckets(buckets_number);
+                        for (std::size_t window = (scalar_bits + window_bits - 1) / window_bits; window-- > 0;) {
+                            for (std::size_t i = 0; i < window_bits; ++i) {
+                                result = result.doubled();
+                            }
+
+                            std::fill(std::begin(buckets), std::end(buckets), PointType::zero());
+                            for (std::size_t i = 0; i < std::size(points); ++i) {
+                                const std::size_t digit =
+                                    static_cast<std::size_t>((digits[i] >> (window * window_bits)) & mask);
+                                if (digit) {
+                                    buckets[digit - 1] = buckets[digit - 1] + points[i];
+                                }
+                            }
+                            /// sum digit * bucket_digit as running sums from the top bucket
+                            PointType running_sum = PointType::zero();
+                            for (std::size_t digit = buckets_number; digit-- > 0;) {
+                                running_sum = running_sum + buckets[digit];
+                                result = result + running_sum;
+                            }
+                        }
+                        return result;
+                    }
+
+                    /// Check signatures \p sigs of the message \p acc on the keys \p pks, writing a result per
+                    /// signature to \p out, e.g. partial signatures of a threshold signature on public shares. As the
+                    /// message is the same, the whole batch is checked with e(H(m), sum r_i * pk_i) ==
+                    /// e(sum r_i * sig_i, g) with a single Miller loop, the range is bisected only if the check fails.
+                    template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                             typename OutputIterator>
+                    static inline OutputIterator verify_single_msg(const internal_accumulator_type &acc,
+                                                                   const std::vector<public_key_type> &pks,
+                                                                   const std::vector<signature_type> &sigs,
+                                                                   OutputIterator out) {
+                        assert(std::size(pks) == std::size(sigs));
+
+                        std::vector<std::uint8_t> results(std::size(sigs), 0);
+                        std::vector<std::size_t> candidates;
+                        for (std::size_t i = 0; i < std::size(sigs); ++i) {
+                            if (validate_signature(sigs[i]) && validate_public_key(pks[i])) {
+                                candidates.push_back(i);
+                            }
+                        }
+
+                        Generator gen;
+                        std::vector<private_key_type> coefficients;
+                        coefficients.reserve(std::size(candidates));
+                        for (std::size_t i = 0; i < std::size(candidates); ++i) {
+                            coefficients.emplace_back(gen());
+                        }
+                        bisect_single_msg_check(hash_to_point(acc), pks, sigs, candidates, coefficients, 0,
+                                                std::size(candidates), results);
+
+                        for (std::uint8_t result : results) {
+                            *out++ = static_cast<bool>(result);
+                        }
+                        return out;
+                    }
+
+                    /// Key aggregation coefficients of the multisignature scheme of BDN18,
+                    /// a_i = H(dst || pk_(1) || ... || pk_(n) || pk_i) truncated to 128 bits, where pk_(j) are the
+                    /// compressed keys of the signers in sorted order, so the coefficients do not depend on the order
+                    /// the signers were added in. The common prefix is hashed once and its state is copied per key.
+                    static inline std::vector<private_key_type>
+                        key_aggregation_coefficients(const std::vector<public_key_type> &pks) {
+                        typedef typename key_aggregation_hash_type::digest_type digest_type;
+                        constexpr std::size_t pk_size = std::tuple_size<public_key_serialized_type>::value;
+
+                        std::vector<std::uint8_t> octets(std::size(pks) * pk_size);
+                        pubkeys_to_octets(pks.data(), std::size(pks), octets.data());
+                        std::vector<public_key_serialized_type> serialized_pks(std::size(pks));
+                        for (std::size_t i = 0; i < std::size(pks); ++i) {
+                            std::copy(std::cbegin(octets) + i * pk_size, std::cbegin(octets) + (i + 1) * pk_size,
+                                      std::begin(serialized_pks[i]));
+                        }
+                        std::vector<public_key_serialized_type> sorted_pks(serialized_pks);
+                        std::sort(std::begin(sorted_pks), std::end(sorted_pks));
+
+                        accumulator_set<key_aggregation_hash_type> prefix_acc;
+                        ::nil::crypto3::hash<key_aggregation_hash_type>(key_aggregation_dst, prefix_acc);
+                        for (const auto &pk : sorted_pks) {
+                            ::nil::crypto3::hash<key_aggregation_hash_type>(pk, prefix_acc);
+                        }
+
+                        std::vector<private_key_type> coefficients;
+                        coefficients.reserve(std::size(pks));
+                        for (const auto &pk : serialized_pks) {
+                            accumulator_set<key_aggregation_hash_type> acc(prefix_acc);
+                            ::nil::crypto3::hash<key_aggregation_hash_type>(pk, acc);
+                            digest_type digest =
+                                ::nil::crypto3::accumulators::extract::hash<key_aggregation_hash_type>(acc);
+
+                            integral_type coefficient = 0;
+                            auto octet = std::cbegin(digest);
+                            for (std::size_t i = 0; i < key_aggregation_coefficient_bits / 8; ++i, ++octet) {
+                                coefficient = (coefficient << 8) + static_cast<std::uint8_t>(*octet);
+                            }
+                            coefficients.emplace_back(coefficient);
+                        }
+                        return coefficients;
+                    }
+
+                    /// aggregated public key sum a_i * pk_i of the multisignature scheme, a single multi-scalar
+                    /// multiplication with 128-bit coefficients
+                    static inline public_key_type aggregate_public_keys(const std::vector<public_key_type> &pks) {
+                        return multi_scalar_multiplication(pks, key_aggregation_coefficients(pks),
+                                                           key_aggregation_coefficient_bits);
+                    }
+
+                    /// aggregated signature sum a_i * sig_i of the multisignature scheme, sigs[i] is made by pks[i]
+                    static inline signature_type aggregate_signatures(const std::vector<public_key_type> &pks,
+                                                                      const std::vector<signature_type> &sigs) {
+                        assert(std::size(pks) == std::size(sigs));
+
+                        return multi_scalar_multiplication(sigs, key_aggregation_coefficients(pks),
+                                                           key_aggregation_coefficient_bits);
+                    }
+
+                    /// add \p pk to the signers unless it was already added, return false otherwise
+                    static inline bool add_public_key(internal_key_aggregation_accumulator_type &acc,
+                                                      const public_key_type &pk, bool validated = false) {
+                        if (!acc.signers.emplace(point_to_pubkey(pk), std::size(acc.first)).second) {
+                            return false;
+                        }
+                        acc.first.emplace_back(pk);
+                        acc.invalid_public_key = acc.invalid_public_key || !(validated || validate_public_key(pk));
+                        return true;
+                    }
+
+                    /// remove \p pk from the signers if it was added, return false otherwise. The last signer takes
+                    /// the place of the removed one, coefficients do not depend on the order of the signers.
+                    static inline bool remove_public_key(internal_key_aggregation_accumulator_type &acc,
+                                                         const public_key_type &pk) {
+                        auto removed = acc.signers.find(point_to_pubkey(pk));
+                        if (removed == std::end(acc.signers)) {
+                            return false;
+                        }
+                        const std::size_t position = removed->second;
+                        acc.signers.erase(removed);
+                        if (position + 1 != std::size(acc.first)) {
+                            acc.first[position] = acc.first.back();
+                            acc.signers[point_to_pubkey(acc.first[position])] = position;
+                        }
+                        acc.first.pop_back();
+                        return true;
+                    }
+
+                    /// add the signature \p sig made with \p pk unless a signature of \p pk was already added, return
+                    /// false otherwise
+                    static inline bool add_signature(internal_keyed_aggregation_accumulator_type &acc,
+                                                     const public_key_type &pk, const signature_type &sig) {
+                        if (!acc.signers.emplace(point_to_pubkey(pk), std::size(acc.first)).second) {
+                            return false;
+                        }
+                        acc.first.emplace_back(pk);
+                        acc.second.emplace_back(sig);
+                        return true;
+                    }
+
+                    /// Every key is validated when added, so the aggregate is checked with two pairings after a single
+                    /// multi-scalar multiplication, whatever the number of signers is.
+                    static inline bool aggregate_verify(const internal_key_aggregation_accumulator_type &acc,
+                                                        const signature_type &sig) {
+                        assert(!acc.first.empty());
 
-                        auto pk_n_iter = pk_n.begin();
-                        public_key_type aggregate_p = *pk_n_iter++;
-                        while (pk_n_iter != pk_n.end()) {
-                            public_key_type next_p = *pk_n_iter++;
-                            aggregate_p = aggregate_p + next_p;
+                        if (acc.invalid_public_key) {
+                            return false;
                         }
-                        return verify(msg_acc, aggregate_p, sig);
+                        public_key_type apk = aggregate_public_keys(acc.first);
+                        return !apk.is_zero() && verify_validated(acc.second, apk, sig);
                     }
 
                     static inline signature_type pop_prove(const private_key_type &sk) {
                         assert(validate_private_key(sk));
 
                         public_key_type pk = privkey_to_pubkey(sk);
-                        signature_type Q = to_curve<h2c_policy>(point_to_pubkey(pk));
-                        return sk * Q;
+                        signature_type Q = hash_public_key(pk);
+                        return secret_scalar_multiplication_policy::multiply(sk, Q);
                     }
 
                     static inline bool pop_verify(const public_key_type &pk, const signature_type &pop) {
-                        if (!pop.is_well_formed()) {
+                        if (!validate_signature(pop)) {
                             return false;
                         }
                         if (!validate_public_key(pk)) {
                             return false;
                         }
-                        signature_type Q = to_curve<h2c_policy>(point_to_pubkey(pk));
-                        auto C1 = policy_type::pairing(Q, pk);
-                        auto C2 = policy_type::pairing(pop, public_key_type::one());
-                        return C1 == C2;
+                        signature_type Q = hash_public_key(pk);
+                        return check_pairing_product(policy_type::miller_loop(Q, pk), pop);
+                    }
+
+                    /// Check proofs of possession of the keys [pk_first, pk_last) given by [pop_first, ...), writing a
+                    /// result per key to \p out. Every proof is weighted with a random scalar r_i and the whole batch
+                    /// is checked with prod e(r_i * H(pk_i), pk_i) * e(-sum r_i * pop_i, g) == 1, the range is bisected
+                    /// only if the check fails, so a batch of valid proofs takes a single final exponentiation.
+                    template<typename Generator = random::algebraic_random_device<scalar_field_type>,
+                             typename PublicKeyIterator, typename SignatureIterator, typename OutputIterator>
+                    static inline OutputIterator pop_batch_verify(PublicKeyIterator pk_first, PublicKeyIterator pk_last,
+                                                                  SignatureIterator pop_first, OutputIterator out) {
+                        std::vector<std::uint8_t> results;
+                        std::vector<pairing_argument_type> args;
+                        std::vector<signature_type> weighted_pops;
+                        std::vector<std::size_t> candidates;
+
+                        Generator gen;
+                        for (; pk_first != pk_last; ++pk_first, ++pop_first) {
+                            const public_key_type &pk = *pk_first;
+                            const signature_type &pop = *pop_first;
+                            results.push_back(0);
+                            if (!validate_signature(pop) || !validate_public_key(pk)) {
+                                continue;
+                            }
+
+                            private_key_type r = gen();
+                            args.emplace_back(r * hash_public_key(pk), pk);
+                            weighted_pops.emplace_back(r * pop);
+                            candidates.push_back(std::size(results) - 1);
+                        }
+                        bisect_pop_check(args, weighted_pops, candidates, 0, std::size(candidates), results);
+
+                        for (std::uint8_t result : results) {
+                            *out++ = static_cast<bool>(result);
+                        }
+                        return out;
+                    }
+
+                    static inline void bisect_pop_check(const std::vector<pairing_argument_type> &args,
+                                                        const std::vector<signature_type> &weighted_pops,
+                                                        const std::vector<std::size_t> &candidates, std::size_t first,
+                                                        std::size_t last, std::vector<std::uint8_t> &results) {
+                        if (first == last) {
+                            return;
+                        }
+
+                        signature_type pop_combination = signature_type::zero();
+                        for (std::size_t i = first; i < last; ++i) {
+                            pop_combination = pop_combination + weighted_pops[i];
+                        }
+                        if (check_pairing_product(policy_type::multi_miller_loop(std::cbegin(args) + first,
+                                                                                 std::cbegin(args) + last),
+                                                  pop_combination)) {
+                            for (std::size_t i = first; i < last; ++i) {
+                                results[candidates[i]] = 1;
+                            }
+                            return;
+                        }
+                        if (last - first == 1) {
+                            return;
+                        }
+
+                        const std::size_t middle = first + (last - first) / 2;
+                        bisect_pop_check(args, weighted_pops, candidates, first, middle, results);
+                        bisect_pop_check(args, weighted_pops, candidates, middle, last, results);
+                    }
+
+                    static inline signature_type hash_public_key(const public_key_type &pk) {
+                        internal_accumulator_type acc;
+                        update(acc, point_to_pubkey(pk));
+                        return hashes::accumulators::extract::to_curve<h2c_policy>(acc);
+                    }
+
+                    static inline void bisect_single_msg_check(const signature_type &Q,
+                                                               const std::vector<public_key_type> &pks,
+                                                               const std::vector<signature_type> &sigs,
+                                                               const std::vector<std::size_t> &candidates,
+                                                               const std::vector<private_key_type> &coefficients,
+                                                               std::size_t first, std::size_t last,
+                                                               std::vector<std::uint8_t> &results) {
+                        if (first == last) {
+                            return;
+                        }
+
+                        std::vector<public_key_type> range_pks;
+                        std::vector<signature_type> range_sigs;
+                        for (std::size_t i = first; i < last; ++i) {
+                            range_pks.emplace_back(pks[candidates[i]]);
+                            range_sigs.emplace_back(sigs[candidates[i]]);
+                        }
+                        const std::vector<private_key_type> range_coefficients(std::cbegin(coefficients) + first,
+                                                                               std::cbegin(coefficients) + last);
+                        if (check_pairing_product(
+                                policy_type::miller_loop(Q, multi_scalar_multiplication(range_pks, range_coefficients)),
+                                multi_scalar_multiplication(range_sigs, range_coefficients))) {
+                            for (std::size_t i = first; i < last; ++i) {
+                                results[candidates[i]] = 1;
+                            }
+                            return;
+                        }
+                        if (last - first == 1) {
+                            return;
+                        }
+
+                        const std::size_t middle = first + (last - first) / 2;
+                        bisect_single_msg_check(Q, pks, sigs, candidates, coefficients, first, middle, results);
+                        bisect_single_msg_check(Q, pks, sigs, candidates, coefficients, middle, last, results);
+                    }
+
+                    /// window of multi_scalar_multiplication for \p n points, about log2(n) - 1 bits balancing the
+                    /// additions to the buckets against the bucket sums
+                    static inline std::size_t msm_window_bits(std::size_t n) {
+                        std::size_t log2_n = 0;
+                        while ((n >> log2_n) > 1) {
+                            ++log2_n;
+                        }
+                        return std::min<std::size_t>(16, std::max<std::size_t>(2, log2_n > 0 ? log2_n - 1 : 0));
+                    }
+
+                    /// Decoding is split into Executor::concurrency() contiguous parts, every part is written only by
+                    /// its own task. Decompression needs a square root per point and yields affine points, so there is
+                    /// no inversion left to share between the elements. Returns the number of valid points.
+                    template<typename Executor, typename SerializedType, typename PointType, typename Decode,
+                             typename Check>
+                    static inline std::size_t points_from_octets(const std::uint8_t *data, std::size_t count,
+                                                                 PointType *points, bool *valid, Decode decode,
+                                                                 Check check) {
+                        constexpr const std::size_t point_size = std::tuple_size<SerializedType>::value;
+
+                        const std::size_t parts_number =
+                            std::max<std::size_t>(1, std::min(Executor::concurrency(), count));
+                        std::vector<std::size_t> valid_numbers(parts_number, 0);
+                        Executor::parallel_for(parts_number, [&](std::size_t part) {
+                            SerializedType octets;
+                            for (std::size_t i = part * count / parts_number; i < (part + 1) * count / parts_number;
+                                 ++i) {
+                                std::copy(data + i * point_size, data + (i + 1) * point_size, std::begin(octets));
+                                valid[i] = false;
+                                try {
+                                    points[i] = decode(octets);
+                                    valid[i] = check(points[i]);
+                                } catch (const std::exception &) {
+                                }
+                                if (!valid[i]) {
+                                    points[i] = PointType::zero();
+                                }
+                                valid_numbers[part] += valid[i];
+                            }
+                        });
+                        return std::accumulate(std::begin(valid_numbers), std::end(valid_numbers), std::size_t(0));
+                    }
+
+                    /// multiply f by Miller loops of the signers [first, last) of the aggregation accumulator, hashed
+                    /// messages of a signer are summed so each signer takes one Miller loop
+                    static inline void aggregate_miller_loop(const internal_aggregation_accumulator_type &acc,
+                                                             std::size_t first, std::size_t last, gt_value_type &f) {
+                        for (std::size_t i = first; i < last; ++i) {
+                            signature_type Q = signature_type::zero();
+                            for (const signature_type &msg_point : acc.second[i]) {
+                                Q = Q + msg_point;
+                            }
+                            f = f * policy_type::miller_loop(Q, acc.first[i]);
+                        }
+                    }
+
+                    /// Inverses of Z coordinates of points [first, last) computed with a single field inversion
+                    /// (Montgomery's trick), the entries of zero points are set to one
+                    template<typename PointIterator,
+                             typename point_type = typename std::iterator_traits<PointIterator>::value_type,
+                             typename coordinate_type = typename point_type::field_type::value_type>
+                    static inline std::vector<coordinate_type> z_inversed(PointIterator first, PointIterator last) {
+                        const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+                        /// products of Z coordinates of the preceding points
+                        std::vector<coordinate_type> result;
+                        result.reserve(n);
+                        coordinate_type z_product = coordinate_type::one();
+                        for (PointIterator it = first; it != last; ++it) {
+                            result.emplace_back(z_product);
+                            if (!it->is_zero()) {
+                                z_product = z_product * it->Z;
+                            }
+                        }
+
+                        coordinate_type z_product_inversed = z_product.inversed();
+                        for (std::size_t i = n; i-- > 0;) {
+                            const point_type &point = *(first + i);
+                            if (point.is_zero()) {
+                                result[i] = coordinate_type::one();
+                                continue;
+                            }
+                            result[i] = z_product_inversed * result[i];
+                            z_product_inversed = z_product_inversed * point.Z;
+                        }
+                        return result;
+                    }
+
+                    /// Convert points [first, last) to affine coordinates with a single field inversion and sum them
+                    /// with mixed additions, which are cheaper than the projective ones. Points are expected in
+                    /// Jacobian coordinates, the input vector is modified.
+                    static inline signature_type sum_normalized(std::vector<signature_type> &points, std::size_t first,
+                                                                std::size_t last) {
+                        typedef typename signature_type::field_type::value_type coordinate_type;
+
+                        const std::vector<coordinate_type> z_inverses =
+                            z_inversed(std::begin(points) + first, std::begin(points) + last);
+                        for (std::size_t i = first; i < last; ++i) {
+                            if (points[i].is_zero()) {
+                                continue;
+                            }
+                            const coordinate_type &z_i_inversed = z_inverses[i - first];
+                            coordinate_type z_i_inversed_squared = z_i_inversed.squared();
+                            points[i] = signature_type(points[i].X * z_i_inversed_squared,
+                                                       points[i].Y * z_i_inversed_squared * z_i_inversed,
+                                                       coordinate_type::one());
+                        }
+
+                        signature_type sum = signature_type::zero();
+                        for (std::size_t i = first; i < last; ++i) {
+                            if (!points[i].is_zero()) {
+                                sum = sum.mixed_add(points[i]);
+                            }
+                        }
+                        return sum;
+                    }
+
+                    /// f * e(-sig, g) == 1 with a single final exponentiation, where f is the product of Miller loops
+                    /// of the message side and the lines of the generator g are precomputed once
+                    static inline bool check_pairing_product(const gt_value_type &f, const signature_type &sig) {
+                        return policy_type::final_exponentiation(
+                                   f * policy_type::miller_loop(-sig, policy_type::public_key_one_precomputed())) ==
+                               gt_value_type::one();
+                    }
+
+                    /// Compressed encoding of points [first, first + count) into out, points are normalized with a
+                    /// single field inversion. The encoding is the one of bls_serializer::point_to_octets_compress: x
+                    /// big-endian, c1 before c0 for Fp2 coordinates, the top bits of the first octet flag compression,
+                    /// the point at infinity and the lexicographically largest y.
+                    template<typename PointType>
+                    static inline void points_to_octets(const PointType *first, std::size_t count, std::uint8_t *out) {
+                        typedef typename PointType::field_type::value_type coordinate_type;
+                        typedef std::is_same<coordinate_type, base_value_type> is_base_coordinate;
+                        constexpr const std::size_t point_size =
+                            base_field_octets * (is_base_coordinate::value ? 1 : 2);
+
+                        const std::vector<coordinate_type> z_inverses = z_inversed(first, first + count);
+                        for (std::size_t i = 0; i < count; ++i, out += point_size) {
+                            std::fill(out, out + point_size, std::uint8_t(0));
+                            if (first[i].is_zero()) {
+                                out[0] = 0xc0;
+                                continue;
+                            }
+                            const coordinate_type z_i_inversed_squared = z_inverses[i].squared();
+                            write_coordinate(first[i].X * z_i_inversed_squared, out, is_base_coordinate());
+                            out[0] |= 0x80;
+                            if (is_lexicographically_largest(first[i].Y * z_i_inversed_squared * z_inverses[i],
+                                                             is_base_coordinate())) {
+                                out[0] |= 0x20;
+                            }
+                        }
+                    }
+
+                    static inline void write_coordinate(const base_value_type &x, std::uint8_t *out, std::true_type) {
+                        base_integral_type value = static_cast<base_integral_type>(x.data);
+                        for (std::size_t i = base_field_octets; i-- > 0;) {
+                            out[i] = static_cast<std::uint8_t>(static_cast<unsigned>(value & 0xff));
+                            value >>= 8;
+                        }
+                    }
+
+                    template<typename CoordinateType>
+                    static inline void write_coordinate(const CoordinateType &x, std::uint8_t *out, std::false_type) {
+                        write_coordinate(x.data[1], out, std::true_type());
+                        write_coordinate(x.data[0], out + base_field_octets, std::true_type());
+                    }
+
+                    static inline bool is_lexicographically_largest(const base_value_type &y, std::true_type) {
+                        return static_cast<base_integral_type>(y.data) > (base_field_type::modulus - 1) / 2;
+                    }
+
+                    template<typename CoordinateType>
+                    static inline bool is_lexicographically_largest(const CoordinateType &y, std::false_type) {
+                        return y.data[1].is_zero() ? is_lexicographically_largest(y.data[0], std::true_type()) :
+                                                     is_lexicographically_largest(y.data[1], std::true_type());
                     }
 
                     static inline public_key_serialized_type point_to_pubkey(const public_key_type &pk) {
@@ -32,8 +32,12 @@
 #include <nil/crypto3/hash/h2c.hpp>
 
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
 
+#include <nil/crypto3/pubkey/detail/bls/bls_scalar_multiplication.hpp>
+#include <nil/crypto3/pubkey/detail/bls/bls_subgroup_check.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
@@ -47,6 +51,15 @@ namespace nil {
                     typedef typename scalar_field_type::modular_type scalar_modular_type;
                     typedef typename curve_type::gt_type::value_type gt_value_type;
 
+                    typedef algebra::pairing::pairing_policy<curve_type> pairing_policy;
+                    typedef typename pairing_policy::g1_precomputed_type g1_precomputed_type;
+                    typedef typename pairing_policy::g2_precomputed_type g2_precomputed_type;
+
+                    typedef typename bls_scalar_multiplication<curve_type>::type scalar_multiplication_policy;
+                    typedef typename bls_secret_scalar_multiplication<curve_type>::type
+                        secret_scalar_multiplication_policy;
+                    typedef typename bls_subgroup_check<curve_type>::type subgroup_check_policy;
+
                     constexpr static std::size_t private_key_bits = scalar_field_type::modulus_bits;
                     constexpr static scalar_modular_type r = curve_type::q;
                 };
@@ -60,8 +73,13 @@ namespace nil {
                     typedef bls_basic_policy<CurveType> basic_policy;
 
                     typedef typename basic_policy::curve_type curve_type;
+                    typedef typename basic_policy::scalar_field_type scalar_field_type;
                     typedef typename basic_policy::gt_value_type gt_value_type;
                     typedef typename basic_policy::scalar_modular_type scalar_modular_type;
+                    typedef typename basic_policy::scalar_multiplication_policy scalar_multiplication_policy;
+                    typedef typename basic_policy::secret_scalar_multiplication_policy
+                        secret_scalar_multiplication_policy;
+                    typedef typename basic_policy::subgroup_check_policy subgroup_check_policy;
 
                     // TODO: pass template parameters for Coordinates and Form of the group
                     typedef typename curve_type::template g2_type<> public_key_group_type;
@@ -79,12 +97,72 @@ namespace nil {
                     constexpr static const std::size_t public_key_bits = public_key_type::value_bits;
                     constexpr static const std::size_t signature_bits = signature_type::value_bits;
 
+                    typedef typename basic_policy::g2_precomputed_type public_key_precomputed_type;
+                    typedef typename basic_policy::g1_precomputed_type signature_precomputed_type;
+
                     typedef hashes::h2c<signature_group_type, PublicParams> h2c_policy;
                     typedef hashing_to_curve_accumulator_set<h2c_policy> internal_accumulator_type;
 
                     static inline gt_value_type pairing(const signature_type &U, const public_key_type &V) {
                         return algebra::pair_reduced<curve_type>(U, V);
                     }
+
+                    /// Miller loop lines of the G2 generator, computed once per process
+                    static inline const public_key_precomputed_type &public_key_one_precomputed() {
+                        static const public_key_precomputed_type precomputed =
+                            precompute_public_key(public_key_type::one());
+                        return precomputed;
+                    }
+
+                    static inline public_key_precomputed_type precompute_public_key(const public_key_type &V) {
+                        return algebra::precompute_g2<curve_type>(V);
+                    }
+
+                    static inline signature_precomputed_type precompute_signature(const signature_type &U) {
+                        return algebra::precompute_g1<curve_type>(U);
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_type &U, const public_key_type &V) {
+                        return algebra::miller_loop<curve_type>(precompute_signature(U), precompute_public_key(V));
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_type &U,
+                                                            const public_key_precomputed_type &V) {
+                        return algebra::miller_loop<curve_type>(precompute_signature(U), V);
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_precomputed_type &U,
+                                                            const public_key_type &V) {
+                        return algebra::miller_loop<curve_type>(U, precompute_public_key(V));
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_precomputed_type &U,
+                                                            const public_key_precomputed_type &V) {
+                        return algebra::miller_loop<curve_type>(U, V);
+                    }
+
+                    static inline gt_value_type final_exponentiation(const gt_value_type &f) {
+                        return algebra::final_exponentiation<curve_type>(f);
+                    }
+
+                    /// Product of Miller loops of (U_i, V_i) pairs in the range, final exponentiation is not applied
+                    template<typename PairIterator>
+                    static inline gt_value_type multi_miller_loop(PairIterator first, PairIterator last) {
+                        gt_value_type f = gt_value_type::one();
+                        while (first != last) {
+                            f = f * miller_loop(first->first, first->second);
+                            ++first;
+                        }
+                        return f;
+                    }
+
+                    static inline public_key_type octets_to_public_key(const public_key_serialized_type &octets) {
+                        return bls_serializer::octets_to_g2_point(octets);
+                    }
+
+                    static inline signature_type octets_to_signature(const signature_serialized_type &octets) {
+                        return bls_serializer::octets_to_g1_point(octets);
+                    }
                 };
 
                 //
@@ -96,8 +174,13 @@ namespace nil {
                     typedef bls_basic_policy<CurveType> basic_policy;
 
                     typedef typename basic_policy::curve_type curve_type;
+                    typedef typename basic_policy::scalar_field_type scalar_field_type;
                     typedef typename basic_policy::gt_value_type gt_value_type;
                     typedef typename basic_policy::scalar_modular_type scalar_modular_type;
+                    typedef typename basic_policy::scalar_multiplication_policy scalar_multiplication_policy;
+                    typedef typename basic_policy::secret_scalar_multiplication_policy
+                        secret_scalar_multiplication_policy;
+                    typedef typename basic_policy::subgroup_check_policy subgroup_check_policy;
 
                     // TODO: pass template parameters for Coordinates and Form of the group
                     typedef typename curve_type::template g1_type<> public_key_group_type;
@@ -115,6 +198,9 @@ namespace nil {
                     constexpr static const std::size_t public_key_bits = public_key_type::value_bits;
                     constexpr static const std::size_t signature_bits = signature_type::value_bits;
 
+                    typedef typename basic_policy::g1_precomputed_type public_key_precomputed_type;
+                    typedef typename basic_policy::g2_precomputed_type signature_precomputed_type;
+
                     typedef hashes::h2c<signature_group_type, PublicParams> h2c_policy;
                     typedef hashing_to_curve_accumulator_set<h2c_policy> internal_accumulator_type;
 
@@ -122,6 +208,55 @@ namespace nil {
                         return algebra::pair_reduced<curve_type>(V, U);
                     }
 
+                    /// Miller loop lines of the G1 generator, computed once per process
+                    static inline const public_key_precomputed_type &public_key_one_precomputed() {
+                        static const public_key_precomputed_type precomputed =
+                            precompute_public_key(public_key_type::one());
+                        return precomputed;
+                    }
+
+                    static inline public_key_precomputed_type precompute_public_key(const public_key_type &V) {
+                        return algebra::precompute_g1<curve_type>(V);
+                    }
+
+                    static inline signature_precomputed_type precompute_signature(const signature_type &U) {
+                        return algebra::precompute_g2<curve_type>(U);
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_type &U, const public_key_type &V) {
+                        return algebra::miller_loop<curve_type>(precompute_public_key(V), precompute_signature(U));
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_type &U,
+                                                            const public_key_precomputed_type &V) {
+                        return algebra::miller_loop<curve_type>(V, precompute_signature(U));
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_precomputed_type &U,
+                                                            const public_key_type &V) {
+                        return algebra::miller_loop<curve_type>(precompute_public_key(V), U);
+                    }
+
+                    static inline gt_value_type miller_loop(const signature_precomputed_type &U,
+                                                            const public_key_precomputed_type &V) {
+                        return algebra::miller_loop<curve_type>(V, U);
+                    }
+
+                    static inline gt_value_type final_exponentiation(const gt_value_type &f) {
+                        return algebra::final_exponentiation<curve_type>(f);
+                    }
+
+                    /// Product of Miller loops of (U_i, V_i) pairs in the range, final exponentiation is not applied
+                    template<typename PairIterator>
+                    static inline gt_value_type multi_miller_loop(PairIterator first, PairIterator last) {
+                        gt_value_type f = gt_value_type::one();
+                        while (first != last) {
+                            f = f * miller_loop(first->first, first->second);
+                            ++first;
+                        }
+                        return f;
+                    }
+
                     static inline public_key_serialized_type point_to_pubkey(const public_key_type &pubkey) {
                         return bls_serializer::point_to_octets_compress(pubkey);
                     }
@@ -129,6 +264,14 @@ namespace nil {
                     static inline signature_serialized_type point_to_signature(const signature_type &sig) {
                         return bls_serializer::point_to_octets_compress(sig);
                     }
+
+                    static inline public_key_type octets_to_public_key(const public_key_serialized_type &octets) {
+                        return bls_serializer::octets_to_g1_point(octets);
+                    }
+
+                    static inline signature_type octets_to_signature(const signature_serialized_type &octets) {
+                        return bls_serializer::octets_to_g2_point(octets);
+                    }
                 };
             }    // namespace detail
         }        // namespace pubkey
@@ -0,0 +1,160 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_BLS_ENDOMORPHISM_HPP
+#define CRYPTO3_PUBKEY_BLS_ENDOMORPHISM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            namespace detail {
+                /*!
+                 * @brief Endomorphisms of BLS12-381 used to speed up scalar multiplication and subgroup checks.
+                 *
+                 * phi(x, y) = (beta * x, y), where beta is a cube root of unity in Fp, is defined on both E(Fp) and
+                 * E'(Fp2) and acts on their order r subgroups as multiplication by lambda = z^2 - 1. Which of the two
+                 * nontrivial cube roots matches lambda is checked once per group on the generator.
+                 *
+                 * psi(x, y) = (conj(x) * c_x, conj(y) * c_y) is the untwist-Frobenius-twist endomorphism of E'(Fp2),
+                 * which acts on G2 as multiplication by z.
+                 *
+                 * Both maps are applied to projective coordinates directly.
+                 */
+                struct bls12_381_endomorphism {
+                    typedef algebra::curves::bls12_381 curve_type;
+                    typedef typename curve_type::base_field_type base_field_type;
+                    typedef typename base_field_type::value_type base_value_type;
+                    typedef typename base_field_type::integral_type base_integral_type;
+                    typedef typename curve_type::scalar_field_type scalar_field_type;
+                    typedef typename scalar_field_type::value_type scalar_value_type;
+                    typedef typename scalar_field_type::integral_type integral_type;
+
+                    typedef typename curve_type::template g1_type<>::value_type g1_value_type;
+                    typedef typename curve_type::template g2_type<>::value_type g2_value_type;
+                    typedef typename g2_value_type::field_type::value_type g2_coordinate_type;
+
+                    /// |z|, z = -0xd201000000010000 is the parameter of the curve
+                    constexpr static const std::uint64_t z_abs = 0xd201000000010000;
+
+                    static inline const integral_type &lambda() {
+                        static const integral_type value("0xac45a4010001a40200000000ffffffff");
+                        return value;
+                    }
+
+                    /// beta for which phi acts on the group as lambda, zero if there is none
+                    template<typename GroupValueType>
+                    static inline const base_value_type &phi_beta() {
+                        static const base_value_type value = select_beta<GroupValueType>();
+                        return value;
+                    }
+
+                    template<typename GroupValueType>
+                    static inline GroupValueType phi(const base_value_type &beta, const GroupValueType &P) {
+                        typedef typename GroupValueType::field_type::value_type coordinate_type;
+
+                        return GroupValueType(
+                            embed<coordinate_type>(beta, std::is_same<coordinate_type, base_value_type>()) * P.X, P.Y,
+                            P.Z);
+                    }
+
+                    /// true if psi acts on G2 as multiplication by z, checked once on the generator
+                    static inline bool psi_available() {
+                        static const bool value = psi(g2_value_type::one()) == -multiply_by_z_abs(g2_value_type::one());
+                        return value;
+                    }
+
+                    static inline g2_value_type psi(const g2_value_type &P) {
+                        return g2_value_type(conjugate(P.X) * psi_coefficients().first,
+                                             conjugate(P.Y) * psi_coefficients().second, conjugate(P.Z));
+                    }
+
+                    /// |z| * P, |z| has only 6 bits set, so it takes 63 doublings and 5 additions
+                    template<typename GroupValueType>
+                    static inline GroupValueType multiply_by_z_abs(const GroupValueType &P) {
+                        GroupValueType R = P;
+                        for (std::size_t i = 63; i-- > 0;) {
+                            R = R.doubled();
+                            if ((z_abs >> i) & 1u) {
+                                R = R + P;
+                            }
+                        }
+                        return R;
+                    }
+
+                private:
+                    template<typename GroupValueType>
+                    static inline base_value_type select_beta() {
+                        const base_value_type beta = base_value_type(base_integral_type(
+                            "0x5f19672fdf76ce51ba69c6076a0f77eaddb3a93be6f89688de17d813620a00022e01fffffffefffe"));
+                        const GroupValueType one = GroupValueType::one();
+                        const GroupValueType lambda_one = scalar_value_type(lambda()) * one;
+
+                        for (const base_value_type &candidate : {beta, beta.squared()}) {
+                            if (phi(candidate, one) == lambda_one) {
+                                return candidate;
+                            }
+                        }
+                        return base_value_type::zero();
+                    }
+
+                    /// c_x = 1 / (1 + u)^((p - 1) / 3), c_y = 1 / (1 + u)^((p - 1) / 2)
+                    static inline const std::pair<g2_coordinate_type, g2_coordinate_type> &psi_coefficients() {
+                        static const std::pair<g2_coordinate_type, g2_coordinate_type> value = []() {
+                            const g2_coordinate_type xi(base_value_type::one(), base_value_type::one());
+                            const base_integral_type p_minus_one = base_field_type::modulus - 1;
+                            return std::make_pair(xi.pow(p_minus_one / 3).inversed(),
+                                                  xi.pow(p_minus_one / 2).inversed());
+                        }();
+                        return value;
+                    }
+
+                    static inline g2_coordinate_type conjugate(const g2_coordinate_type &a) {
+                        return g2_coordinate_type(a.data[0], -a.data[1]);
+                    }
+
+                    template<typename CoordinateType>
+                    static inline CoordinateType embed(const base_value_type &value, std::true_type) {
+                        return value;
+                    }
+
+                    /// G2 coordinates are in Fp2 and beta is embedded as beta + 0 * u
+                    template<typename CoordinateType>
+                    static inline CoordinateType embed(const base_value_type &value, std::false_type) {
+                        return CoordinateType(value, base_value_type::zero());
+                    }
+                };
+            }    // namespace detail
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_BLS_ENDOMORPHISM_HPP
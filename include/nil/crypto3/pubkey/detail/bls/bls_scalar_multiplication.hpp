@@ -0,0 +1,305 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_BLS_SCALAR_MULTIPLICATION_HPP
+#define CRYPTO3_PUBKEY_BLS_SCALAR_MULTIPLICATION_HPP
+
+#include <cstddef>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <nil/crypto3/pubkey/detail/bls/bls_endomorphism.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            namespace detail {
+                /// Multiplication provided by the group implementation
+                struct bls_default_scalar_multiplication {
+                    template<typename ScalarValueType, typename GroupValueType>
+                    static inline GroupValueType multiply(const ScalarValueType &k, const GroupValueType &P) {
+                        return k * P;
+                    }
+                };
+
+                /*!
+                 * @brief Multiplication on BLS12-381 G1 and G2 using the endomorphism phi acting on the order r
+                 * subgroups as multiplication by lambda = z^2 - 1, see bls12_381_endomorphism. k * P = k_1 * P + k_2 *
+                 * phi(P) with k = k_1 + k_2 * lambda and both k_1, k_2 of half the bit length. Both halves are
+                 * recoded in wNAF form and processed in a single double-and-add loop, halving the number of doublings.
+                 *
+                 * The eigenvalue of the endomorphism is checked once per group on the generator, if it does not match
+                 * the multiplication falls back to the one provided by the group implementation.
+                 *
+                 * The multiplication is variable time: the digits of the decomposition select the table entries and
+                 * the additions made, so it is only used with scalars which are not secret, private keys are multiplied
+                 * by bls12_381_regular_glv_scalar_multiplication.
+                 */
+                struct bls12_381_glv_scalar_multiplication {
+                    typedef bls12_381_endomorphism endomorphism_type;
+                    typedef typename endomorphism_type::base_value_type base_value_type;
+                    typedef typename endomorphism_type::scalar_value_type scalar_value_type;
+                    typedef typename endomorphism_type::integral_type integral_type;
+
+                    constexpr static const std::size_t window_bits = 4;
+                    constexpr static const std::size_t table_size = std::size_t(1) << (window_bits - 2);
+
+                    template<typename GroupValueType>
+                    static inline GroupValueType multiply(const scalar_value_type &k, const GroupValueType &P) {
+                        const base_value_type &beta = endomorphism_type::template phi_beta<GroupValueType>();
+                        if (beta.is_zero() || P.is_zero()) {
+                            return k * P;
+                        }
+
+                        const integral_type k_integral = static_cast<integral_type>(k.data);
+                        const std::vector<int> k1_digits = wnaf(k_integral % endomorphism_type::lambda());
+                        const std::vector<int> k2_digits = wnaf(k_integral / endomorphism_type::lambda());
+
+                        /// odd multiples P, 3P, ..., (2^(w - 1) - 1)P and their images under the endomorphism
+                        std::vector<GroupValueType> table(table_size), endomorphism_table(table_size);
+                        const GroupValueType P_doubled = P.doubled();
+                        table[0] = P;
+                        for (std::size_t i = 1; i < table_size; ++i) {
+                            table[i] = table[i - 1] + P_doubled;
+                        }
+                        for (std::size_t i = 0; i < table_size; ++i) {
+                            endomorphism_table[i] = endomorphism_type::phi(beta, table[i]);
+                        }
+
+                        GroupValueType R = GroupValueType::zero();
+                        for (std::size_t i = std::max(std::size(k1_digits), std::size(k2_digits)); i-- > 0;) {
+                            R = R.doubled();
+                            if (i < std::size(k1_digits)) {
+                                add_digit(R, table, k1_digits[i]);
+                            }
+                            if (i < std::size(k2_digits)) {
+                                add_digit(R, endomorphism_table, k2_digits[i]);
+                            }
+                        }
+                        return R;
+                    }
+
+                private:
+                    template<typename GroupValueType>
+                    static inline void add_digit(GroupValueType &R, const std::vector<GroupValueType> &table,
+                                                 int digit) {
+                        if (digit > 0) {
+                            R = R + table[digit / 2];
+                        } else if (digit < 0) {
+                            R = R - table[-digit / 2];
+                        }
+                    }
+
+                    /// width-w non-adjacent form, least significant digit first
+                    static inline std::vector<int> wnaf(integral_type k) {
+                        const unsigned window = 1u << window_bits;
+                        std::vector<int> digits;
+                        while (k > 0) {
+                            int digit = 0;
+                            const unsigned low = static_cast<unsigned>(k % window);
+                            if (low & 1u) {
+                                digit = low >= window / 2 ? static_cast<int>(low) - static_cast<int>(window) :
+                                                            static_cast<int>(low);
+                                if (digit > 0) {
+                                    k -= digit;
+                                } else {
+                                    k += -digit;
+                                }
+                            }
+                            digits.push_back(digit);
+                            k >>= 1;
+                        }
+                        return digits;
+                    }
+                };
+
+                /*!
+                 * @brief Multiplication on BLS12-381 G1 and G2 by secret scalars using the same decomposition k = k_1 +
+                 * k_2 * lambda as bls12_381_glv_scalar_multiplication.
+                 *
+                 * Both halves are made odd, the correction is subtracted at the end, and recoded in the regular signed
+                 * form: a fixed number of odd digits in [-(2^w - 1), 2^w - 1], so every step of the loop makes w
+                 * doublings and two additions whatever the scalar is. The table entry for a digit is read by scanning
+                 * the whole table and selecting the coordinates arithmetically, and negated by multiplying Y by +-1, so
+                 * neither the memory accessed nor the group operations made depend on the scalar.
+                 *
+                 * The integer arithmetic of the decomposition and the exceptional cases of the addition formulas are
+                 * those of the multiprecision backend and of the group implementation.
+                 */
+                struct bls12_381_regular_glv_scalar_multiplication {
+                    typedef bls12_381_endomorphism endomorphism_type;
+                    typedef typename endomorphism_type::base_value_type base_value_type;
+                    typedef typename endomorphism_type::base_integral_type base_integral_type;
+                    typedef typename endomorphism_type::scalar_value_type scalar_value_type;
+                    typedef typename endomorphism_type::integral_type integral_type;
+
+                    constexpr static const std::size_t window_bits = 4;
+                    constexpr static const std::size_t table_size = std::size_t(1) << (window_bits - 1);
+                    /// both halves of the decomposition and their odd corrections are below 2^128
+                    constexpr static const std::size_t half_scalar_bits = 128;
+                    constexpr static const std::size_t digits_number = half_scalar_bits / window_bits + 1;
+
+                    template<typename GroupValueType>
+                    static inline GroupValueType multiply(const scalar_value_type &k, const GroupValueType &P) {
+                        const base_value_type &beta = endomorphism_type::template phi_beta<GroupValueType>();
+                        if (beta.is_zero() || P.is_zero()) {
+                            return k * P;
+                        }
+
+                        const integral_type k_integral = static_cast<integral_type>(k.data);
+                        const integral_type k1 = k_integral % endomorphism_type::lambda();
+                        const integral_type k2 = k_integral / endomorphism_type::lambda();
+                        const unsigned k1_even = 1u - static_cast<unsigned>(k1 & 1u);
+                        const unsigned k2_even = 1u - static_cast<unsigned>(k2 & 1u);
+                        const std::vector<int> k1_digits = regular_recoding(k1 + k1_even);
+                        const std::vector<int> k2_digits = regular_recoding(k2 + k2_even);
+
+                        /// odd multiples P, 3P, ..., (2^w - 1)P and their images under the endomorphism
+                        std::vector<GroupValueType> table(table_size), endomorphism_table(table_size);
+                        const GroupValueType P_doubled = P.doubled();
+                        table[0] = P;
+                        for (std::size_t i = 1; i < table_size; ++i) {
+                            table[i] = table[i - 1] + P_doubled;
+                        }
+                        for (std::size_t i = 0; i < table_size; ++i) {
+                            endomorphism_table[i] = endomorphism_type::phi(beta, table[i]);
+                        }
+
+                        GroupValueType R =
+                            lookup(table, k1_digits.back()) + lookup(endomorphism_table, k2_digits.back());
+                        for (std::size_t i = digits_number - 1; i-- > 0;) {
+                            for (std::size_t j = 0; j < window_bits; ++j) {
+                                R = R.doubled();
+                            }
+                            R = R + lookup(table, k1_digits[i]);
+                            R = R + lookup(endomorphism_table, k2_digits[i]);
+                        }
+                        R = select(k1_even, R - table[0], R);
+                        return select(k2_even, R - endomorphism_table[0], R);
+                    }
+
+                private:
+                    /// digits d_i of an odd k = sum d_i * 2^(w * i), least significant first, the last one is 1
+                    static inline std::vector<int> regular_recoding(integral_type k) {
+                        const unsigned window = 1u << (window_bits + 1);
+                        std::vector<int> digits(digits_number);
+                        for (std::size_t i = 0; i < digits_number - 1; ++i) {
+                            const unsigned low = static_cast<unsigned>(k % window);
+                            digits[i] = static_cast<int>(low) - static_cast<int>(window / 2);
+                            // (k - d_i) / 2^w, which is odd again
+                            k = ((k >> (window_bits + 1)) << 1) + 1;
+                        }
+                        BOOST_ASSERT(k == 1);
+                        digits.back() = static_cast<int>(static_cast<unsigned>(k));
+                        return digits;
+                    }
+
+                    /// \p digit * P for an odd \p digit, reading every entry of \p table
+                    template<typename GroupValueType>
+                    static inline GroupValueType lookup(const std::vector<GroupValueType> &table, int digit) {
+                        typedef typename GroupValueType::field_type::value_type coordinate_type;
+
+                        const unsigned negative =
+                            static_cast<unsigned>(digit) >> (std::numeric_limits<unsigned>::digits - 1);
+                        const unsigned magnitude = (static_cast<unsigned>(digit) ^ (0u - negative)) + negative;
+                        const unsigned index = magnitude >> 1;
+
+                        GroupValueType R = table[0];
+                        for (std::size_t i = 1; i < std::size(table); ++i) {
+                            R = select(equals(static_cast<unsigned>(i), index), table[i], R);
+                        }
+                        const coordinate_type sign = coordinate<coordinate_type>(1u) -
+                                                     coordinate<coordinate_type>(negative) -
+                                                     coordinate<coordinate_type>(negative);
+                        return GroupValueType(R.X, R.Y * sign, R.Z);
+                    }
+
+                    /// \p A if \p bit is 1 and \p B if it is 0
+                    template<typename GroupValueType>
+                    static inline GroupValueType select(unsigned bit, const GroupValueType &A,
+                                                        const GroupValueType &B) {
+                        typedef typename GroupValueType::field_type::value_type coordinate_type;
+
+                        const coordinate_type c = coordinate<coordinate_type>(bit);
+                        return GroupValueType(B.X + (A.X - B.X) * c, B.Y + (A.Y - B.Y) * c, B.Z + (A.Z - B.Z) * c);
+                    }
+
+                    /// 1 if \p a equals \p b, 0 otherwise
+                    static inline unsigned equals(unsigned a, unsigned b) {
+                        const unsigned difference = a ^ b;
+                        return 1u ^ ((difference | (0u - difference)) >> (std::numeric_limits<unsigned>::digits - 1));
+                    }
+
+                    template<typename CoordinateType>
+                    static inline CoordinateType coordinate(unsigned value) {
+                        return coordinate<CoordinateType>(value, std::is_same<CoordinateType, base_value_type>());
+                    }
+
+                    template<typename CoordinateType>
+                    static inline CoordinateType coordinate(unsigned value, std::true_type) {
+                        return base_value_type(base_integral_type(value));
+                    }
+
+                    /// G2 coordinates are in Fp2 and the value is embedded as value + 0 * u
+                    template<typename CoordinateType>
+                    static inline CoordinateType coordinate(unsigned value, std::false_type) {
+                        return CoordinateType(base_value_type(base_integral_type(value)), base_value_type::zero());
+                    }
+                };
+
+                /// Scalar multiplication of non-secret scalars, e.g. the random coefficients of batch verification,
+                /// could be specialized to plug in a faster one for a curve
+                template<typename CurveType>
+                struct bls_scalar_multiplication {
+                    typedef bls_default_scalar_multiplication type;
+                };
+
+                template<>
+                struct bls_scalar_multiplication<algebra::curves::bls12_381> {
+                    typedef bls12_381_glv_scalar_multiplication type;
+                };
+
+                /// Scalar multiplication of private keys, a specialization should not branch on or index by the scalar
+                template<typename CurveType>
+                struct bls_secret_scalar_multiplication {
+                    typedef bls_default_scalar_multiplication type;
+                };
+
+                template<>
+                struct bls_secret_scalar_multiplication<algebra::curves::bls12_381> {
+                    typedef bls12_381_regular_glv_scalar_multiplication type;
+                };
+            }    // namespace detail
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_BLS_SCALAR_MULTIPLICATION_HPP
@@ -0,0 +1,108 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_BLS_SUBGROUP_CHECK_HPP
+#define CRYPTO3_PUBKEY_BLS_SUBGROUP_CHECK_HPP
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <nil/crypto3/pubkey/detail/bls/bls_endomorphism.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            namespace detail {
+                /// No subgroup check beyond the is_well_formed check of the group implementation
+                struct bls_default_subgroup_check {
+                    template<typename GroupValueType>
+                    static inline bool is_in_subgroup(const GroupValueType &P) {
+                        return true;
+                    }
+                };
+
+                /*!
+                 * @brief Subgroup membership tests for BLS12-381 points on the curve, which cost about a quarter of
+                 * the multiplication by the group order r.
+                 *
+                 * G1: P is in G1 iff phi'(P) = -z^2 * P (Bowe, "Faster subgroup checks for BLS12-381"), where phi' is
+                 * the endomorphism acting on G1 as lambda^2 = -z^2, i.e. the one with the squared beta of phi, and
+                 * z^2 * P is computed with two multiplications by the 64-bit |z|.
+                 *
+                 * G2: P is in G2 iff psi(P) = z * P (Scott, "A note on group membership tests for G1, G2 and GT on
+                 * BLS pairing-friendly curves").
+                 *
+                 * If an endomorphism does not pass the self-check on the generator, r * P = 0 is checked as
+                 * lambda * (lambda * P) + lambda * P + P = 0, since r = lambda^2 + lambda + 1.
+                 */
+                struct bls12_381_subgroup_check {
+                    typedef bls12_381_endomorphism endomorphism_type;
+                    typedef typename endomorphism_type::base_value_type base_value_type;
+                    typedef typename endomorphism_type::scalar_value_type scalar_value_type;
+                    typedef typename endomorphism_type::g1_value_type g1_value_type;
+                    typedef typename endomorphism_type::g2_value_type g2_value_type;
+
+                    static inline bool is_in_subgroup(const g1_value_type &P) {
+                        const base_value_type &beta = endomorphism_type::template phi_beta<g1_value_type>();
+                        if (beta.is_zero()) {
+                            return is_in_subgroup_by_order(P);
+                        }
+                        const g1_value_type z_squared_P =
+                            endomorphism_type::multiply_by_z_abs(endomorphism_type::multiply_by_z_abs(P));
+                        return endomorphism_type::phi(beta.squared(), P) == -z_squared_P;
+                    }
+
+                    static inline bool is_in_subgroup(const g2_value_type &P) {
+                        if (!endomorphism_type::psi_available()) {
+                            return is_in_subgroup_by_order(P);
+                        }
+                        return endomorphism_type::psi(P) == -endomorphism_type::multiply_by_z_abs(P);
+                    }
+
+                private:
+                    template<typename GroupValueType>
+                    static inline bool is_in_subgroup_by_order(const GroupValueType &P) {
+                        const scalar_value_type lambda(endomorphism_type::lambda());
+                        const GroupValueType lambda_P = lambda * P;
+                        return (lambda * lambda_P + lambda_P + P).is_zero();
+                    }
+                };
+
+                /// Subgroup check applied to public keys and signatures, could be specialized to plug in a faster one
+                /// for a curve
+                template<typename CurveType>
+                struct bls_subgroup_check {
+                    typedef bls_default_subgroup_check type;
+                };
+
+                template<>
+                struct bls_subgroup_check<algebra::curves::bls12_381> {
+                    typedef bls12_381_subgroup_check type;
+                };
+            }    // namespace detail
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_BLS_SUBGROUP_CHECK_HPP
@@ -0,0 +1,138 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_LRU_CACHE_HPP
+#define CRYPTO3_PUBKEY_LRU_CACHE_HPP
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/assert.hpp>
+#include <boost/container_hash/hash.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            namespace detail {
+                /// index of lru_cache entries, a hash table with boost::hash of the key
+                template<typename Key>
+                struct lru_hash_index {
+                    template<typename Iterator>
+                    struct bind {
+                        typedef std::unordered_map<Key, Iterator, boost::hash<Key>> type;
+                    };
+
+                    template<typename IndexType>
+                    static inline void reserve(IndexType &index, std::size_t size) {
+                        index.reserve(size);
+                    }
+                };
+
+                /// index of lru_cache entries, an ordered map for keys without a hash function
+                template<typename Key>
+                struct lru_ordered_index {
+                    template<typename Iterator>
+                    struct bind {
+                        typedef std::map<Key, Iterator> type;
+                    };
+
+                    template<typename IndexType>
+                    static inline void reserve(IndexType &index, std::size_t size) {
+                    }
+                };
+
+                /*!
+                 * @brief Bounded map keeping the most recently used entries first, when it is full the least recently
+                 * used entry is evicted. Entries are kept in a list, so a hit moves its entry to the front without
+                 * copying, and are found through an index of list iterators. The cache is not thread-safe.
+                 *
+                 * @tparam Key
+                 * @tparam Value
+                 * @tparam Index lru_hash_index or lru_ordered_index of Key
+                 */
+                template<typename Key, typename Value, typename Index = lru_hash_index<Key>>
+                struct lru_cache {
+                    typedef Key key_type;
+                    typedef Value value_type;
+
+                    lru_cache() = delete;
+                    lru_cache(std::size_t capacity) : max_size(capacity) {
+                        BOOST_ASSERT(max_size > 0);
+                        Index::reserve(index, max_size);
+                    }
+
+                    /// return the value of \p key, constructing it with \p make and evicting the least recently used
+                    /// entry if the cache is full on a miss
+                    template<typename Make>
+                    const value_type &get(const key_type &key, Make make) {
+                        auto found_it = index.find(key);
+                        if (found_it != index.end()) {
+                            entries.splice(entries.begin(), entries, found_it->second);
+                            return found_it->second->second;
+                        }
+
+                        if (entries.size() == max_size) {
+                            index.erase(entries.back().first);
+                            entries.pop_back();
+                        }
+                        entries.emplace_front(key, make());
+                        index.emplace(key, entries.begin());
+                        return entries.front().second;
+                    }
+
+                    inline bool contains(const key_type &key) const {
+                        return index.count(key) > 0;
+                    }
+
+                    inline std::size_t size() const {
+                        return entries.size();
+                    }
+
+                    inline std::size_t capacity() const {
+                        return max_size;
+                    }
+
+                    inline void clear() {
+                        index.clear();
+                        entries.clear();
+                    }
+
+                protected:
+                    typedef std::list<std::pair<key_type, value_type>> entries_type;
+                    typedef typename Index::template bind<typename entries_type::iterator>::type index_type;
+
+                    std::size_t max_size;
+                    entries_type entries;
+                    index_type index;
+                };
+            }    // namespace detail
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_LRU_CACHE_HPP
@@ -0,0 +1,75 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_THREAD_EXECUTOR_HPP
+#define CRYPTO3_PUBKEY_THREAD_EXECUTOR_HPP
+
+#include <cstddef>
+#include <vector>
+#include <future>
+#include <thread>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            namespace detail {
+                /*!
+                 * @brief Default executor of the parallel processing modes.
+                 *
+                 * An executor is a stateless policy with two static members:
+                 * - concurrency() returns the number of parts the work should be split into;
+                 * - parallel_for(n, task) calls task(i) for every i in [0, n) and returns when all the calls are
+                 * finished, rethrowing an exception thrown by any of them.
+                 *
+                 * This one runs every part except the first one in a separate std::thread, the first part is run on
+                 * the calling thread. Other executors, e.g. backed by a thread pool, could be plugged in the same way.
+                 */
+                struct thread_executor {
+                    static inline std::size_t concurrency() {
+                        std::size_t n = std::thread::hardware_concurrency();
+                        return n ? n : 1;
+                    }
+
+                    template<typename Task>
+                    static inline void parallel_for(std::size_t n, const Task &task) {
+                        std::vector<std::future<void>> results;
+                        results.reserve(n);
+                        for (std::size_t i = 1; i < n; ++i) {
+                            results.emplace_back(std::async(std::launch::async, task, i));
+                        }
+                        if (n > 0) {
+                            task(0);
+                        }
+                        for (auto &result : results) {
+                            result.get();
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_THREAD_EXECUTOR_HPP
@@ -0,0 +1,107 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_HASHED_MESSAGE_CACHE_HPP
+#define CRYPTO3_PUBKEY_HASHED_MESSAGE_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <memory>
+#include <algorithm>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/pubkey/keys/public_key.hpp>
+#include <nil/crypto3/pubkey/detail/lru_cache.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            /*!
+             * @brief Bounded cache of messages hashed to the curve, for workloads where many signers sign the same
+             * message. Messages are indexed by their SHA-256 digest, the DST is fixed by the scheme. When the cache is
+             * full the least recently used message is evicted. The cache is not thread-safe.
+             *
+             * Hashed messages are passed to public_key<Scheme>::verify or to the aggregate verification accumulator
+             * in place of the message.
+             *
+             * @tparam Scheme public key signature scheme, messages of which do not depend on the signer
+             */
+            template<typename Scheme>
+            struct hashed_message_cache {
+                typedef public_key<Scheme> key_type;
+                typedef typename key_type::prepared_message_type prepared_message_type;
+                typedef std::shared_ptr<const prepared_message_type> value_type;
+
+                typedef hashes::sha2<256> digest_hash_type;
+                typedef std::array<std::uint8_t, digest_hash_type::digest_bits / 8> message_digest_type;
+
+                hashed_message_cache() = delete;
+                hashed_message_cache(std::size_t capacity) : cache(capacity) {
+                }
+
+                /// return hashed \p msg, hashing and caching it on a miss
+                template<typename InputRange>
+                value_type get(const InputRange &msg) {
+                    return cache.get(message_digest(msg), [&msg]() {
+                        return std::make_shared<const prepared_message_type>(key_type::hash_message(msg));
+                    });
+                }
+
+                template<typename InputRange>
+                inline bool contains(const InputRange &msg) const {
+                    return cache.contains(message_digest(msg));
+                }
+
+                inline std::size_t size() const {
+                    return cache.size();
+                }
+
+                inline std::size_t capacity() const {
+                    return cache.capacity();
+                }
+
+                inline void clear() {
+                    cache.clear();
+                }
+
+            protected:
+                template<typename InputRange>
+                static inline message_digest_type message_digest(const InputRange &msg) {
+                    typename digest_hash_type::digest_type digest = hash<digest_hash_type>(msg);
+                    message_digest_type result;
+                    std::copy(std::begin(digest), std::end(digest), std::begin(result));
+                    return result;
+                }
+
+                detail::lru_cache<message_digest_type, value_type> cache;
+            };
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_HASHED_MESSAGE_CACHE_HPP
@@ -0,0 +1,49 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_PREPARED_PUBLIC_KEY_HPP
+#define CRYPTO3_PUBKEY_PREPARED_PUBLIC_KEY_HPP
+
+#include <nil/crypto3/pubkey/keys/public_key.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            /*!
+             * @brief
+             *
+             * @ingroup pubkey_algorithms
+             *
+             * Prepared public key - a public key extended with the data precomputed from the key material once
+             * and reused by every verification made with this key. It is usable everywhere public_key<Scheme> is.
+             *
+             */
+            template<typename Scheme, typename = void>
+            struct prepared_public_key;
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_PREPARED_PUBLIC_KEY_HPP
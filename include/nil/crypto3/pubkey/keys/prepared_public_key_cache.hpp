@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_PREPARED_PUBLIC_KEY_CACHE_HPP
+#define CRYPTO3_PUBKEY_PREPARED_PUBLIC_KEY_CACHE_HPP
+
+#include <cstddef>
+
+#include <nil/crypto3/pubkey/keys/prepared_public_key.hpp>
+#include <nil/crypto3/pubkey/detail/lru_cache.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            /*!
+             * @brief Bounded cache of prepared public keys indexed by their serialized representation. When the
+             * cache is full the least recently used key is evicted. The cache is not thread-safe.
+             *
+             * @tparam Scheme public key signature scheme
+             */
+            template<typename Scheme>
+            struct prepared_public_key_cache {
+                typedef prepared_public_key<Scheme> prepared_key_type;
+                typedef typename prepared_key_type::key_type key_type;
+                typedef typename prepared_key_type::public_key_serialized_type serialized_key_type;
+
+                prepared_public_key_cache() = delete;
+                prepared_public_key_cache(std::size_t capacity) : cache(capacity) {
+                }
+
+                /// return prepared key for \p pubkey, preparing and caching it on a miss
+                prepared_key_type get(const key_type &pubkey) {
+                    return cache.get(prepared_key_type::serialize(pubkey),
+                                     [&pubkey]() { return prepared_key_type(pubkey); });
+                }
+
+                inline bool contains(const key_type &pubkey) const {
+                    return cache.contains(prepared_key_type::serialize(pubkey));
+                }
+
+                inline std::size_t size() const {
+                    return cache.size();
+                }
+
+                inline std::size_t capacity() const {
+                    return cache.capacity();
+                }
+
+                inline void clear() {
+                    cache.clear();
+                }
+
+            protected:
+                detail::lru_cache<serialized_key_type, prepared_key_type> cache;
+            };
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_PREPARED_PUBLIC_KEY_CACHE_HPP
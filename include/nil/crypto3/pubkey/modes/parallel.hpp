@@ -0,0 +1,111 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_PARALLEL_MODE_HPP
+#define CRYPTO3_PUBKEY_PARALLEL_MODE_HPP
+
+#include <nil/crypto3/pubkey/detail/thread_executor.hpp>
+
+#include <nil/crypto3/pubkey/modes/isomorphic.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            namespace detail {
+                template<typename Op, typename Executor>
+                struct parallel_operation_policy : public isomorphic_operation_policy<Op> {
+                    typedef isomorphic_operation_policy<Op> base_type;
+                    typedef Executor executor_type;
+
+                    typedef typename base_type::op_type op_type;
+                    typedef typename base_type::result_type result_type;
+
+                    template<typename... Args>
+                    static inline result_type process(Args &...args) {
+                        return op_type::template process<executor_type>(args...);
+                    }
+                };
+
+                template<typename Op, typename Executor>
+                struct parallel_update_operation_policy : public isomorphic_operation_policy<Op> {
+                    typedef isomorphic_operation_policy<Op> base_type;
+                    typedef Executor executor_type;
+
+                    typedef typename base_type::op_type op_type;
+
+                    template<typename... Args>
+                    inline static void update(Args &...args) {
+                        op_type::template update<executor_type>(args...);
+                    }
+                };
+
+                /// both the updates and the processing are given the executor, so the updates could leave the heavy
+                /// part of their work to the processing, which splits it across the workers
+                template<typename Op, typename Executor>
+                struct parallel_deferred_operation_policy : public parallel_operation_policy<Op, Executor> {
+                    typedef parallel_operation_policy<Op, Executor> base_type;
+                    typedef Executor executor_type;
+
+                    typedef typename base_type::op_type op_type;
+
+                    template<typename... Args>
+                    inline static void update(Args &...args) {
+                        op_type::template update<executor_type>(args...);
+                    }
+                };
+            }    // namespace detail
+
+            namespace modes {
+                /*!
+                 * @brief Processing mode splitting the heavy part of the operations, supporting it, across the
+                 * workers of \p Executor. The rest of the policies are the same as in isomorphic mode.
+                 *
+                 * @ingroup pubkey_scheme_modes
+                 *
+                 * @tparam Scheme
+                 * @tparam Executor stateless policy running the parts of the work, see detail::thread_executor
+                 */
+                template<typename Scheme, typename Executor = detail::thread_executor>
+                struct parallel : public isomorphic<Scheme> {
+                    typedef Scheme scheme_type;
+                    typedef Executor executor_type;
+
+                    typedef detail::parallel_deferred_operation_policy<aggregate_verify_op<scheme_type>,
+                                                                       executor_type>
+                        aggregate_verification_policy;
+                    typedef detail::parallel_update_operation_policy<aggregate_op<scheme_type>, executor_type>
+                        aggregation_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::isomorphic<Policy> type;
+                    };
+                };
+            }    // namespace modes
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_PARALLEL_MODE_HPP
@@ -0,0 +1,64 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_PIPELINED_MODE_HPP
+#define CRYPTO3_PUBKEY_PIPELINED_MODE_HPP
+
+#include <nil/crypto3/pubkey/modes/isomorphic.hpp>
+
+#include <nil/crypto3/pubkey/operations/pipelined_aggregate_verify_op.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            namespace modes {
+                /*!
+                 * @brief Processing mode doing the work of aggregate verification as the inputs arrive: every
+                 * (public key, message) pair is hashed and paired when it is passed to the accumulator, so only the
+                 * final check is left once the aggregated signature is known. The rest of the policies are the same
+                 * as in isomorphic mode.
+                 *
+                 * @ingroup pubkey_scheme_modes
+                 *
+                 * @tparam Scheme
+                 */
+                template<typename Scheme>
+                struct pipelined : public isomorphic<Scheme> {
+                    typedef Scheme scheme_type;
+
+                    typedef detail::isomorphic_operation_policy<pipelined_aggregate_verify_op<scheme_type>>
+                        aggregate_verification_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::isomorphic<Policy> type;
+                    };
+                };
+            }    // namespace modes
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_PIPELINED_MODE_HPP
@@ -0,0 +1,70 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_THRESHOLD_MODE_HPP
+#define CRYPTO3_PUBKEY_THRESHOLD_MODE_HPP
+
+#include <nil/crypto3/pubkey/modes/isomorphic.hpp>
+
+#include <nil/crypto3/pubkey/operations/threshold_aggregate_op.hpp>
+
+#include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            namespace modes {
+                /*!
+                 * @brief Processing mode of a threshold signature scheme, signing keys of which are shares of a
+                 * secret key dealt by \p SecretSharingScheme. Signing and verification of partial signatures are the
+                 * same as in isomorphic mode with a share used as a key, aggregation combines partial signatures
+                 * indexed by the participants into the signature of the secret key.
+                 *
+                 * @ingroup pubkey_scheme_modes
+                 *
+                 * @tparam Scheme
+                 * @tparam SecretSharingScheme secret sharing scheme over the group of public keys of \p Scheme
+                 */
+                template<typename Scheme, template<typename> class SecretSharingScheme = shamir_sss>
+                struct threshold : public isomorphic<Scheme> {
+                    typedef Scheme scheme_type;
+                    typedef SecretSharingScheme<typename public_key<scheme_type>::public_key_group_type>
+                        secret_sharing_scheme_type;
+
+                    typedef detail::isomorphic_operation_policy<
+                        threshold_aggregate_op<scheme_type, secret_sharing_scheme_type>>
+                        aggregation_policy;
+
+                    template<typename Policy>
+                    struct bind {
+                        typedef detail::isomorphic<Policy> type;
+                    };
+                };
+            }    // namespace modes
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_THRESHOLD_MODE_HPP
@@ -40,6 +40,7 @@
 #include <nil/crypto3/pubkey/keys/agreement_key.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/iterator_last.hpp>
 #include <nil/crypto3/pubkey/accumulators/parameters/key.hpp>
+#include <nil/crypto3/pubkey/accumulators/parameters/signature.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -131,6 +132,29 @@ namespace nil {
                                               ::nil::crypto3::accumulators::key = pubkey);
                     }
 
+                    template<typename SinglePassRange, typename Scheme>
+                    range_pubkey_impl(const SinglePassRange &range, accumulator_set_type &&ise,
+                                      const public_key<Scheme> &pubkey,
+                                      const typename public_key<Scheme>::signature_type &signature) :
+                        SchemeStateImpl(std::forward<accumulator_set_type>(ise)) {
+                        BOOST_RANGE_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SinglePassRange>));
+
+                        this->accumulator_set(range, ::nil::crypto3::accumulators::key = pubkey,
+                                              ::nil::crypto3::accumulators::signature = signature);
+                    }
+
+                    template<typename InputIterator, typename Scheme>
+                    range_pubkey_impl(InputIterator first, InputIterator last, accumulator_set_type &&ise,
+                                      const public_key<Scheme> &pubkey,
+                                      const typename public_key<Scheme>::signature_type &signature) :
+                        SchemeStateImpl(std::forward<accumulator_set_type>(ise)) {
+                        BOOST_CONCEPT_ASSERT((boost::InputIteratorConcept<InputIterator>));
+
+                        this->accumulator_set(first, ::nil::crypto3::accumulators::iterator_last = last,
+                                              ::nil::crypto3::accumulators::key = pubkey,
+                                              ::nil::crypto3::accumulators::signature = signature);
+                    }
+
                     // TODO: fix
                     template<typename Scheme>
                     range_pubkey_impl(accumulator_set_type &&ise,
@@ -0,0 +1,87 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_PUBKEY_LAGRANGE_COEFFICIENTS_CACHE_HPP
+#define CRYPTO3_PUBKEY_LAGRANGE_COEFFICIENTS_CACHE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <nil/crypto3/pubkey/detail/lru_cache.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            /*!
+             * @brief Bounded cache of Lagrange coefficients at zero indexed by the quorum of participants, for
+             * workloads where the same quorum combines many shares. When the cache is full the least recently used
+             * quorum is evicted. The cache is not thread-safe.
+             *
+             * @tparam SecretSharingScheme Shamir secret sharing scheme or a scheme derived from it
+             */
+            template<typename SecretSharingScheme>
+            struct lagrange_coefficients_cache {
+                typedef SecretSharingScheme scheme_type;
+                typedef typename scheme_type::indexes_type indexes_type;
+                typedef typename scheme_type::private_element_type private_element_type;
+                typedef std::shared_ptr<const std::vector<private_element_type>> value_type;
+
+                lagrange_coefficients_cache() = delete;
+                lagrange_coefficients_cache(std::size_t capacity) : cache(capacity) {
+                }
+
+                /// return coefficients of \p indexes in their order, computing and caching them on a miss
+                value_type get(const indexes_type &indexes) {
+                    return cache.get(indexes, [&indexes]() {
+                        return std::make_shared<const std::vector<private_element_type>>(
+                            scheme_type::eval_basis_polys(indexes));
+                    });
+                }
+
+                inline bool contains(const indexes_type &indexes) const {
+                    return cache.contains(indexes);
+                }
+
+                inline std::size_t size() const {
+                    return cache.size();
+                }
+
+                inline std::size_t capacity() const {
+                    return cache.capacity();
+                }
+
+                inline void clear() {
+                    cache.clear();
+                }
+
+            protected:
+                detail::lru_cache<indexes_type, value_type, detail::lru_ordered_index<indexes_type>> cache;
+            };
+        }    // namespace pubkey
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_LAGRANGE_COEFFICIENTS_CACHE_HPP
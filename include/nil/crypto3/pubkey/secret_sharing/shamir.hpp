@@ -81,6 +81,44 @@ namespace nil {
                     return result;
                 }
 
+                /// basis polynomials of all the participants \p indexes evaluated at zero, in the order of \p indexes,
+                /// computed with a single field inversion for the whole quorum
+                static inline std::vector<typename basic_policy::private_element_type>
+                    eval_basis_polys(const typename basic_policy::indexes_type &indexes) {
+                    typedef typename basic_policy::private_element_type private_element_type;
+
+                    std::vector<private_element_type> numerators, denominators;
+                    for (auto i : indexes) {
+                        assert(basic_policy::check_participant_index(i));
+
+                        private_element_type e_i(i);
+                        private_element_type numerator = private_element_type::one();
+                        private_element_type denominator = private_element_type::one();
+                        for (auto j : indexes) {
+                            if (j != i) {
+                                numerator = numerator * private_element_type(j);
+                                denominator = denominator * (private_element_type(j) - e_i);
+                            }
+                        }
+                        numerators.emplace_back(numerator);
+                        denominators.emplace_back(denominator);
+                    }
+
+                    /// Montgomery's trick: invert the product of the denominators and unwind it from the end
+                    std::vector<private_element_type> prefix_products;
+                    private_element_type product = private_element_type::one();
+                    for (const auto &denominator : denominators) {
+                        prefix_products.emplace_back(product);
+                        product = product * denominator;
+                    }
+                    private_element_type inversed = product.inversed();
+                    for (std::size_t k = std::size(denominators); k-- > 0;) {
+                        numerators[k] = numerators[k] * inversed * prefix_products[k];
+                        inversed = inversed * denominators[k];
+                    }
+                    return numerators;
+                }
+
                 //===========================================================================
                 // TODO: refactor
                 // polynomial generation functions
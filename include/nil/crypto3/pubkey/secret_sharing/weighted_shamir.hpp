@@ -27,6 +27,7 @@
 #define CRYPTO3_PUBKEY_WEIGHTED_SHAMIR_SSS_HPP
 
 #include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/lagrange_coefficients_cache.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -35,6 +36,31 @@ namespace nil {
             struct weighted_shamir_sss : public shamir_sss<Group> {
                 typedef sss_weighted_basic_policy<Group> basic_policy;
                 typedef shamir_sss<Group> base_type;
+
+                typedef lagrange_coefficients_cache<weighted_shamir_sss> coeffs_cache_type;
+
+                /// Lagrange coefficients of the parts [first, last) of a participant, taken from \p coeffs of all the
+                /// \p confirmed_indexes given in their order. Parts of a participant have consecutive indexes, so
+                /// they are found with a single lookup.
+                template<typename PartIt>
+                static inline std::vector<typename basic_policy::private_element_type>
+                    get_part_coeffs(const typename basic_policy::indexes_type &confirmed_indexes,
+                                    const std::vector<typename basic_policy::private_element_type> &coeffs,
+                                    PartIt first, PartIt last) {
+                    std::vector<typename basic_policy::private_element_type> part_coeffs;
+                    if (first == last) {
+                        return part_coeffs;
+                    }
+
+                    auto index_it = confirmed_indexes.find(first->get_index());
+                    assert(index_it != std::cend(confirmed_indexes));
+                    std::size_t position = std::distance(std::cbegin(confirmed_indexes), index_it);
+                    for (auto iter = first; iter != last; ++iter, ++index_it, ++position) {
+                        assert(index_it != std::cend(confirmed_indexes) && *index_it == iter->get_index());
+                        part_coeffs.emplace_back(coeffs[position]);
+                    }
+                    return part_coeffs;
+                }
             };
 
             template<typename Group>
@@ -111,12 +137,27 @@ namespace nil {
                 inline part_public_share_type
                     to_shamir(const typename scheme_type::weights_type &confirmed_weights) const {
                     auto confirmed_indexes = scheme_type::get_indexes(confirmed_weights, t);
+                    return to_shamir(confirmed_indexes, scheme_type::eval_basis_polys(confirmed_indexes));
+                }
+
+                /// the same, coefficients of the confirmed quorum are taken from \p coeffs_cache
+                inline part_public_share_type to_shamir(const typename scheme_type::weights_type &confirmed_weights,
+                                                        typename scheme_type::coeffs_cache_type &coeffs_cache) const {
+                    auto confirmed_indexes = scheme_type::get_indexes(confirmed_weights, t);
+                    return to_shamir(confirmed_indexes, *coeffs_cache.get(confirmed_indexes));
+                }
+
+            protected:
+                inline part_public_share_type
+                    to_shamir(const indexes_type &confirmed_indexes,
+                              const std::vector<typename scheme_type::private_element_type> &coeffs) const {
+                    auto part_coeffs = scheme_type::get_part_coeffs(confirmed_indexes, coeffs,
+                                                                    std::cbegin(public_share.second),
+                                                                    std::cend(public_share.second));
 
                     typename scheme_type::public_element_type part_share = scheme_type::public_element_type::zero();
-                    for (const auto &public_share_j : public_share.second) {
-                        part_share = part_share +
-                                     public_share_j.get_value() *
-                                         scheme_type::eval_basis_poly(confirmed_indexes, public_share_j.get_index());
+                    for (std::size_t j = 0; j < std::size(part_coeffs); ++j) {
+                        part_share = part_share + public_share.second[j].get_value() * part_coeffs[j];
                     }
 
                     return part_public_share_type(public_share.first, part_share);
@@ -197,13 +238,31 @@ namespace nil {
                     }
                 }
 
+                /// Collapse the parts of the share into a single share of the confirmed quorum in the scalar field,
+                /// so a participant makes a single group multiplication, e.g. a single partial signature, whatever
+                /// its weight is. Coefficients of the quorum take a single field inversion.
                 inline part_share_type to_shamir(const typename scheme_type::weights_type &confirmed_weights) const {
                     auto confirmed_indexes = scheme_type::get_indexes(confirmed_weights, t);
+                    return to_shamir(confirmed_indexes, scheme_type::eval_basis_polys(confirmed_indexes));
+                }
+
+                /// the same, coefficients of the confirmed quorum are taken from \p coeffs_cache
+                inline part_share_type to_shamir(const typename scheme_type::weights_type &confirmed_weights,
+                                                 typename scheme_type::coeffs_cache_type &coeffs_cache) const {
+                    auto confirmed_indexes = scheme_type::get_indexes(confirmed_weights, t);
+                    return to_shamir(confirmed_indexes, *coeffs_cache.get(confirmed_indexes));
+                }
+
+            protected:
+                inline part_share_type
+                    to_shamir(const indexes_type &confirmed_indexes,
+                              const std::vector<typename scheme_type::private_element_type> &coeffs) const {
+                    auto part_coeffs = scheme_type::get_part_coeffs(confirmed_indexes, coeffs,
+                                                                    std::cbegin(share.second), std::cend(share.second));
 
                     typename scheme_type::private_element_type part_share = scheme_type::private_element_type::zero();
-                    for (const auto &share_j : share.second) {
-                        part_share = part_share + share_j.get_value() * scheme_type::eval_basis_poly(
-                                                                            confirmed_indexes, share_j.get_index());
+                    for (std::size_t j = 0; j < std::size(part_coeffs); ++j) {
+                        part_share = part_share + share.second[j].get_value() * part_coeffs[j];
                     }
 
                     return part_share_type(share.first, part_share);
@@ -35,16 +35,28 @@
 #include <nil/crypto3/pubkey/algorithm/aggregate.hpp>
 #include <nil/crypto3/pubkey/algorithm/aggregate_verify.hpp>
 #include <nil/crypto3/pubkey/algorithm/aggregate_verify_single_msg.hpp>
+#include <nil/crypto3/pubkey/algorithm/batch_verify.hpp>
+#include <nil/crypto3/pubkey/algorithm/validate_signatures.hpp>
+#include <nil/crypto3/pubkey/algorithm/deal_shares.hpp>
 
 #include <nil/crypto3/pubkey/bls.hpp>
+#include <nil/crypto3/pubkey/keys/prepared_public_key_cache.hpp>
+#include <nil/crypto3/pubkey/hashed_message_cache.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/shamir.hpp>
+#include <nil/crypto3/pubkey/secret_sharing/weighted_shamir.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
 
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
 #include <vector>
 #include <string>
+#include <algorithm>
+#include <iterator>
 #include <utility>
 #include <random>
+#include <memory>
 
 using namespace nil::crypto3::algebra;
 using namespace nil::crypto3::pubkey;
@@ -303,6 +315,78 @@ BOOST_AUTO_TEST_CASE(g2_serialization_test) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+/// Points of BLS12-381 on the curve but of small order, 3 on G1 and 13 on G2. Added to points of the prime order
+/// subgroup they give points passing is_well_formed but not the subgroup checks.
+using bls12_381_g1_value_type = typename curves::bls12_381::g1_type<>::value_type;
+using bls12_381_g2_value_type = typename curves::bls12_381::g2_type<>::value_type;
+
+template<typename GroupValueType>
+GroupValueType small_order_point();
+
+template<>
+bls12_381_g1_value_type small_order_point<bls12_381_g1_value_type>() {
+    return bls12_381_g1_value_type(0, 2, 1);
+}
+
+template<>
+bls12_381_g2_value_type small_order_point<bls12_381_g2_value_type>() {
+    using integral_type = typename bls12_381_g2_value_type::field_type::integral_type;
+    return bls12_381_g2_value_type(
+        {{integral_type("33028116962366930488174327109372002071541460628884722441244012310885415688258807794364800554"
+                        "88906969507825521497988"),
+          integral_type("21591617619985720298271157151352516485164135375307641445460984094159012143386057077098593683"
+                        "08445700024446995204964")}},
+        {{integral_type("91827276318145929977778504980148525173942576432506718333290436981533291280808810948628812568"
+                        "8779618627172051883901"),
+          integral_type("15203422172148457083973115244939518768426299383602599655954832983675995835105901711639925424"
+                        "60916921937176980633828")}},
+        {{1, 0}});
+}
+
+BOOST_AUTO_TEST_SUITE(bls_scalar_multiplication)
+
+/// the multiplications of BLS12-381 give the same points as the group implementation, scalars 0, 1 and r - 1 included
+template<typename ScalarMultiplication, typename GroupValueType>
+void glv_scalar_multiplication_test() {
+    using scalar_field_type = typename curves::bls12_381::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+
+    nil::crypto3::random::algebraic_random_device<scalar_field_type> gen;
+    std::vector<scalar_value_type> scalars = {scalar_value_type::zero(), scalar_value_type::one(),
+                                              -scalar_value_type::one()};
+    for (std::size_t i = 0; i < 16; ++i) {
+        scalars.push_back(gen());
+    }
+
+    const GroupValueType P = gen() * GroupValueType::one();
+    for (const auto &k : scalars) {
+        BOOST_CHECK_EQUAL(ScalarMultiplication::multiply(k, GroupValueType::one()), k * GroupValueType::one());
+        BOOST_CHECK_EQUAL(ScalarMultiplication::multiply(k, P), k * P);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(bls12_381_glv_g1) {
+    glv_scalar_multiplication_test<::nil::crypto3::pubkey::detail::bls12_381_glv_scalar_multiplication,
+                                   bls12_381_g1_value_type>();
+}
+
+BOOST_AUTO_TEST_CASE(bls12_381_glv_g2) {
+    glv_scalar_multiplication_test<::nil::crypto3::pubkey::detail::bls12_381_glv_scalar_multiplication,
+                                   bls12_381_g2_value_type>();
+}
+
+BOOST_AUTO_TEST_CASE(bls12_381_regular_glv_g1) {
+    glv_scalar_multiplication_test<::nil::crypto3::pubkey::detail::bls12_381_regular_glv_scalar_multiplication,
+                                   bls12_381_g1_value_type>();
+}
+
+BOOST_AUTO_TEST_CASE(bls12_381_regular_glv_g2) {
+    glv_scalar_multiplication_test<::nil::crypto3::pubkey::detail::bls12_381_regular_glv_scalar_multiplication,
+                                   bls12_381_g2_value_type>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 // TODO: add checks for wrong signatures
 template<typename Scheme, typename MsgRange>
 void conformity_test(const std::vector<private_key<Scheme>> &sks,
@@ -521,6 +605,36 @@ void self_test(const std::vector<private_key<Scheme>> &sks, const std::vector<Ms
     auto wrong_sig = integral_type(2) * sig;
     BOOST_CHECK_EQUAL(!static_cast<bool>(::nil::crypto3::verify(*msgs_iter, wrong_sig, pubkey)), true);
 
+    const prepared_public_key<scheme_type> prepared_pubkey(pubkey);
+    BOOST_CHECK_EQUAL(prepared_pubkey.is_prepared(), true);
+    BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::verify(*msgs_iter, sig, prepared_pubkey)), true);
+    BOOST_CHECK_EQUAL(!static_cast<bool>(::nil::crypto3::verify(*msgs_iter, wrong_sig, prepared_pubkey)), true);
+
+    const validated_public_key<scheme_type> validated_pubkey(pubkey.public_key_data());
+    BOOST_CHECK_EQUAL(validated_pubkey.is_validated(), true);
+    BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::verify(*msgs_iter, sig, validated_pubkey)), true);
+    BOOST_CHECK_EQUAL(!static_cast<bool>(::nil::crypto3::verify(*msgs_iter, wrong_sig, validated_pubkey)), true);
+    BOOST_CHECK_THROW(validated_public_key<scheme_type>(_pubkey_type::zero()), std::invalid_argument);
+
+    // on the curve, but outside the subgroup
+    using basic_functions = typename scheme_type::bls_scheme_type::basic_functions;
+    const _pubkey_type non_subgroup_pubkey = pubkey.public_key_data() + small_order_point<_pubkey_type>();
+    const signature_type non_subgroup_sig = sig + small_order_point<signature_type>();
+    BOOST_CHECK(non_subgroup_pubkey.is_well_formed());
+    BOOST_CHECK(non_subgroup_sig.is_well_formed());
+    BOOST_CHECK_EQUAL(basic_functions::validate_public_key(non_subgroup_pubkey), false);
+    BOOST_CHECK_EQUAL(basic_functions::validate_public_key(small_order_point<_pubkey_type>()), false);
+    BOOST_CHECK_EQUAL(basic_functions::validate_signature(non_subgroup_sig), false);
+    BOOST_CHECK_EQUAL(basic_functions::validate_signature(small_order_point<signature_type>()), false);
+    BOOST_CHECK_THROW(validated_public_key<scheme_type>(non_subgroup_pubkey), std::invalid_argument);
+    BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::verify(*msgs_iter, non_subgroup_sig, pubkey)), false);
+
+    prepared_public_key_cache<scheme_type> pubkey_cache(1);
+    BOOST_CHECK_EQUAL(
+        static_cast<bool>(::nil::crypto3::verify(*msgs_iter, sig, pubkey_cache.get(pubkey.public_key_data()))), true);
+    BOOST_CHECK_EQUAL(pubkey_cache.contains(pubkey.public_key_data()), true);
+    BOOST_CHECK_EQUAL(pubkey_cache.size(), 1);
+
     sks_iter++;
     msgs_iter++;
 
@@ -552,11 +666,171 @@ void self_test(const std::vector<private_key<Scheme>> &sks, const std::vector<Ms
 
     signature_type agg_sig = ::nil::crypto3::aggregate<scheme_type>(sigs);
 
+    std::vector<signature_type> many_sigs;
+    signature_type many_sigs_sum = signature_type::zero();
+    for (std::size_t i = 0; i < 100; ++i) {
+        many_sigs.emplace_back(sigs[i % sigs.size()]);
+        many_sigs_sum = many_sigs_sum + many_sigs.back();
+    }
+    BOOST_CHECK_EQUAL(static_cast<signature_type>(::nil::crypto3::aggregate<scheme_type>(many_sigs)), many_sigs_sum);
+
+    using parallel_aggregation_acc_set = aggregation_accumulator_set<parallel_aggregation_processing_mode<scheme_type>>;
+    using parallel_aggregation_acc =
+        typename boost::mpl::front<typename parallel_aggregation_acc_set::features_type>::type;
+    auto parallel_agg_acc = parallel_aggregation_acc_set();
+    ::nil::crypto3::aggregate<scheme_type>(many_sigs, parallel_agg_acc);
+    BOOST_CHECK_EQUAL(boost::accumulators::extract_result<parallel_aggregation_acc>(parallel_agg_acc), many_sigs_sum);
+
     // TODO: extend public interface to be able to supply signature into accumulator
     agg_ver_acc(agg_sig);
 //    ::nil::crypto3::aggregate_verify<scheme_type>(agg_sig, agg_ver_acc);
     auto res = boost::accumulators::extract_result<aggregate_verification_acc>(agg_ver_acc);
     BOOST_CHECK_EQUAL(res, true);
+
+    using parallel_aggregate_verification_acc_set =
+        aggregate_verification_accumulator_set<parallel_aggregate_verification_processing_mode<scheme_type>>;
+    using parallel_aggregate_verification_acc =
+        typename boost::mpl::front<typename parallel_aggregate_verification_acc_set::features_type>::type;
+
+    auto parallel_agg_ver_acc = parallel_aggregate_verification_acc_set();
+    for (std::size_t i = 0; i < sigs.size(); ++i) {
+        ::nil::crypto3::aggregate_verify<scheme_type>(msgs[i + 1], *pks[i], parallel_agg_ver_acc);
+    }
+    parallel_agg_ver_acc(agg_sig);
+    res = boost::accumulators::extract_result<parallel_aggregate_verification_acc>(parallel_agg_ver_acc);
+    BOOST_CHECK_EQUAL(res, true);
+
+    // the parallel mode hashes the messages it keeps once their number reaches the limit
+    {
+        using aggregate_verify_op_type = aggregate_verify_op<scheme_type>;
+        using executor_type = ::nil::crypto3::pubkey::detail::thread_executor;
+        const std::size_t limit = scheme_type::bls_scheme_type::basic_functions::deferred_messages_limit;
+        typename aggregate_verify_op_type::internal_accumulator_type deferred_acc;
+        for (std::size_t i = 0; i <= limit; ++i) {
+            aggregate_verify_op_type::template update<executor_type>(deferred_acc, *pks.front(), msgs[1]);
+            BOOST_CHECK_LT(deferred_acc.deferred_messages.size(), limit);
+        }
+        BOOST_CHECK_EQUAL(deferred_acc.deferred_messages.size(), 1);
+        const signature_type repeated_sig = integral_type(limit + 1) * sigs.front();
+        BOOST_CHECK(aggregate_verify_op_type::template process<executor_type>(deferred_acc, repeated_sig));
+    }
+
+    using pipelined_aggregate_verification_acc_set =
+        aggregate_verification_accumulator_set<pipelined_aggregate_verification_processing_mode<scheme_type>>;
+    using pipelined_aggregate_verification_acc =
+        typename boost::mpl::front<typename pipelined_aggregate_verification_acc_set::features_type>::type;
+
+    auto pipelined_agg_ver_acc = pipelined_aggregate_verification_acc_set();
+    for (std::size_t i = 0; i < sigs.size(); ++i) {
+        ::nil::crypto3::aggregate_verify<scheme_type>(msgs[i + 1], *pks[i], pipelined_agg_ver_acc);
+    }
+    pipelined_agg_ver_acc(agg_sig);
+    res = boost::accumulators::extract_result<pipelined_aggregate_verification_acc>(pipelined_agg_ver_acc);
+    BOOST_CHECK_EQUAL(res, true);
+    auto wrong_pipelined_agg_ver_acc = pipelined_aggregate_verification_acc_set();
+    for (std::size_t i = 0; i < sigs.size(); ++i) {
+        ::nil::crypto3::aggregate_verify<scheme_type>(msgs[i + 1], *pks[i], wrong_pipelined_agg_ver_acc);
+    }
+    wrong_pipelined_agg_ver_acc(signature_type(agg_sig - sigs.front()));
+    res = boost::accumulators::extract_result<pipelined_aggregate_verification_acc>(wrong_pipelined_agg_ver_acc);
+    BOOST_CHECK_EQUAL(res, false);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Batch verify
+    using batch_verification_mode = typename ::nil::crypto3::pubkey::modes::isomorphic<scheme_type>::template bind<
+        ::nil::crypto3::pubkey::batch_verification_policy<Scheme>>::type;
+    using batch_verification_acc_set = batch_verification_accumulator_set<batch_verification_mode>;
+    using batch_verification_acc = typename boost::mpl::front<typename batch_verification_acc_set::features_type>::type;
+
+    std::vector<msg_type> batch_msgs(std::next(msgs.begin()), msgs.end());
+    std::vector<pubkey_type> batch_pks;
+    for (const auto pk : pks) {
+        batch_pks.emplace_back(*pk);
+    }
+    BOOST_CHECK_EQUAL(::nil::crypto3::batch_verify<scheme_type>(batch_msgs, sigs, batch_pks), true);
+
+    // every message needs its signature and its key, a partial or an empty batch is rejected
+    std::vector<pubkey_type> short_batch_pks(batch_pks.begin(), batch_pks.end() - 1);
+    BOOST_CHECK_EQUAL(::nil::crypto3::batch_verify<scheme_type>(batch_msgs, sigs, short_batch_pks), false);
+    std::vector<signature_type> short_sigs(sigs.begin(), sigs.end() - 1);
+    BOOST_CHECK_EQUAL(::nil::crypto3::batch_verify<scheme_type>(batch_msgs, short_sigs, batch_pks), false);
+    BOOST_CHECK_EQUAL(::nil::crypto3::batch_verify<scheme_type>(std::vector<msg_type>(),
+                                                                std::vector<signature_type>(),
+                                                                std::vector<pubkey_type>()),
+                      false);
+
+    auto batch_ver_acc = batch_verification_acc_set();
+    for (std::size_t i = 0; i < sigs.size(); ++i) {
+        ::nil::crypto3::batch_verify<scheme_type>(batch_msgs[i], sigs[i], *pks[i], batch_ver_acc);
+    }
+    res = boost::accumulators::extract_result<batch_verification_acc>(batch_ver_acc);
+    BOOST_CHECK_EQUAL(res, true);
+
+    std::vector<signature_type> wrong_sigs = sigs;
+    wrong_sigs.back() = integral_type(2) * wrong_sigs.back();
+
+    std::vector<bool> sigs_validity;
+    ::nil::crypto3::validate_signatures<scheme_type>(sigs, std::back_inserter(sigs_validity));
+    BOOST_CHECK_EQUAL(static_cast<std::size_t>(std::count(sigs_validity.begin(), sigs_validity.end(), true)),
+                      sigs.size());
+
+    // on the curve, but with components of small order, the second one cancels the component of the first one
+    std::vector<signature_type> non_subgroup_sigs = sigs;
+    non_subgroup_sigs.front() = non_subgroup_sigs.front() + small_order_point<signature_type>();
+    non_subgroup_sigs.back() = non_subgroup_sigs.back() - small_order_point<signature_type>();
+    BOOST_CHECK(non_subgroup_sigs.front().is_well_formed());
+    sigs_validity.clear();
+    ::nil::crypto3::validate_signatures<scheme_type>(non_subgroup_sigs, std::back_inserter(sigs_validity));
+    BOOST_CHECK_EQUAL(sigs_validity.front(), false);
+    BOOST_CHECK_EQUAL(sigs_validity.back(), false);
+    BOOST_CHECK_EQUAL(static_cast<std::size_t>(std::count(sigs_validity.begin(), sigs_validity.end(), true)),
+                      sigs.size() - 2);
+
+    // large batches are checked with random subset sums, bisected down to the signatures outside the subgroup
+    using basic_functions = typename scheme_type::bls_scheme_type::basic_functions;
+    const std::size_t large_batch_size = 3 * basic_functions::batch_subgroup_check_threshold;
+    std::vector<signature_type> large_batch(1, sigs.front());
+    std::vector<std::size_t> large_batch_indexes(1, 0);
+    for (std::size_t i = 1; i < large_batch_size; ++i) {
+        large_batch.emplace_back(large_batch.back() + signature_type::one());
+        large_batch_indexes.emplace_back(i);
+    }
+    std::vector<std::uint8_t> large_batch_validity(large_batch_size, 0);
+    basic_functions::batch_subgroup_check(large_batch, large_batch_indexes, 0, large_batch_size, large_batch_validity);
+    BOOST_CHECK_EQUAL(static_cast<std::size_t>(std::count(large_batch_validity.begin(), large_batch_validity.end(), 1)),
+                      large_batch_size);
+    large_batch[7] = large_batch[7] + small_order_point<signature_type>();
+    large_batch[large_batch_size - 3] = large_batch[large_batch_size - 3] - small_order_point<signature_type>();
+    std::fill(large_batch_validity.begin(), large_batch_validity.end(), 0);
+    basic_functions::batch_subgroup_check(large_batch, large_batch_indexes, 0, large_batch_size, large_batch_validity);
+    BOOST_CHECK_EQUAL(large_batch_validity[7], 0);
+    BOOST_CHECK_EQUAL(large_batch_validity[large_batch_size - 3], 0);
+    BOOST_CHECK_EQUAL(static_cast<std::size_t>(std::count(large_batch_validity.begin(), large_batch_validity.end(), 1)),
+                      large_batch_size - 2);
+
+    std::vector<std::uint8_t> sigs_octets;
+    for (const auto &sig : sigs) {
+        auto sig_octets = scheme_type::bls_scheme_type::basic_functions::point_to_signature(sig);
+        sigs_octets.insert(sigs_octets.end(), sig_octets.begin(), sig_octets.end());
+    }
+    const std::size_t sig_octets_size = sigs_octets.size() / sigs.size();
+    std::vector<std::uint8_t> bulk_sigs_octets(sigs_octets.size());
+    pubkey_type::signatures_to_octets(sigs.data(), sigs.size(), bulk_sigs_octets.data());
+    BOOST_CHECK(bulk_sigs_octets == sigs_octets);
+    sigs_octets[sig_octets_size + sig_octets_size / 2] ^= 0x01;
+    std::vector<signature_type> decoded_sigs(sigs.size());
+    std::unique_ptr<bool[]> decoded_validity(new bool[sigs.size()]);
+    BOOST_CHECK_EQUAL(pubkey_type::signatures_from_octets(sigs_octets.data(), sigs.size(), decoded_sigs.data(),
+                                                          decoded_validity.get()),
+                      sigs.size() - 1);
+    BOOST_CHECK_EQUAL(decoded_validity[1], false);
+    for (std::size_t i = 0; i < sigs.size(); ++i) {
+        if (i != 1) {
+            BOOST_CHECK(decoded_validity[i]);
+            BOOST_CHECK_EQUAL(decoded_sigs[i], sigs[i]);
+        }
+    }
+    BOOST_CHECK_EQUAL(::nil::crypto3::batch_verify<scheme_type>(batch_msgs, wrong_sigs, batch_pks), false);
 }
 
 template<typename SchemePopSign, typename SchemePopProve>
@@ -625,6 +899,15 @@ struct conformity_pop_test_case {
 
         using msg_type = MsgRange;
 
+        // conversion between the variants of the scheme shares the key material
+        const prepared_public_key<SchemePopSign> prepared_pubkey(sks_n.front().front());
+        const auto prove_pubkey = static_cast<pubkey_type<SchemePopProve>>(prepared_pubkey);
+        BOOST_CHECK_EQUAL(prove_pubkey.is_prepared(), true);
+        BOOST_CHECK_EQUAL(prove_pubkey.is_validated(), true);
+        BOOST_CHECK_EQUAL(&prove_pubkey.public_key_data(), &prepared_pubkey.public_key_data());
+
+        hashed_message_cache<SchemePopSign> hashed_msgs(2);
+
         auto sks_it = sks_n.begin();
         auto etalon_sigs_it = etalon_sigs_n.begin();
         auto msgs_it = msgs.begin();
@@ -656,6 +939,88 @@ struct conformity_pop_test_case {
                                   *msgs_it, *sks_it, agg_sig)),
                               true);
 
+            auto agg_ver_acc = aggregate_verification_acc_set<>();
+            for (const auto &sk : *sks_it) {
+                ::nil::crypto3::aggregate_verify<SchemePopSign>(*msgs_it, pubkey_type<>(sk), agg_ver_acc);
+            }
+            agg_ver_acc(agg_sig);
+            BOOST_CHECK_EQUAL(boost::accumulators::extract_result<aggregate_verification_acc<>>(agg_ver_acc), true);
+
+            const auto hashed_msg = hashed_msgs.get(*msgs_it);
+            BOOST_CHECK_EQUAL(hashed_msgs.contains(*msgs_it), true);
+            BOOST_CHECK_EQUAL(sks_it->front().verify(*hashed_msg, my_sigs.front()), true);
+            auto hashed_agg_ver_acc = aggregate_verification_acc_set<>();
+            for (const auto &sk : *sks_it) {
+                hashed_agg_ver_acc(*hashed_msg, ::nil::crypto3::accumulators::key = pubkey_type<>(sk));
+            }
+            hashed_agg_ver_acc(agg_sig);
+            BOOST_CHECK_EQUAL(
+                boost::accumulators::extract_result<aggregate_verification_acc<>>(hashed_agg_ver_acc), true);
+
+            if (sks_it->size() > 1) {
+                auto single_msg_acc =
+                    single_msg_aggregate_verification_accumulator_set<single_msg_aggregate_verification_mode<>>(agg_sig);
+                ::nil::crypto3::aggregate_verify_single_msg<SchemePopSign>(*msgs_it, single_msg_acc);
+                ::nil::crypto3::aggregate_verify_single_msg<SchemePopSign>(*sks_it, single_msg_acc);
+                single_msg_acc(::nil::crypto3::accumulators::excluded_key = pubkey_type<>(sks_it->front()));
+                BOOST_CHECK_EQUAL(
+                    boost::accumulators::extract_result<single_msg_aggregate_verification_acc<>>(single_msg_acc), false);
+                single_msg_acc(signature_type<>(agg_sig - my_sigs.front()));
+                BOOST_CHECK_EQUAL(
+                    boost::accumulators::extract_result<single_msg_aggregate_verification_acc<>>(single_msg_acc), true);
+
+                // keys outside the subgroup are rejected, though their components of small order cancel in the sum
+                std::vector<pubkey_type<>> torsion_pubkeys(sks_it->begin(), sks_it->end());
+                torsion_pubkeys[0] = pubkey_type<>(
+                    _pubkey_type<>((*sks_it)[0].public_key_data() + small_order_point<_pubkey_type<>>()));
+                torsion_pubkeys[1] = pubkey_type<>(
+                    _pubkey_type<>((*sks_it)[1].public_key_data() - small_order_point<_pubkey_type<>>()));
+                BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::aggregate_verify_single_msg<SchemePopSign>(
+                                      *msgs_it, torsion_pubkeys, agg_sig)),
+                                  false);
+
+                // the first key is registered with a proof of another key
+                pop_registry<SchemePopSign> registry;
+                for (std::size_t i = 0; i < sks_it->size(); ++i) {
+                    registry.register_key(pubkey_type<>((*sks_it)[i]), my_proofs[i == 0 ? 1 : i]);
+                }
+                BOOST_CHECK_EQUAL(registry.verify_pending(), std::size_t(1));
+                BOOST_CHECK_EQUAL(registry.contains(pubkey_type<>(sks_it->front())), false);
+                BOOST_CHECK_EQUAL(registry.size(), sks_it->size() - 1);
+
+                auto registered_acc =
+                    single_msg_aggregate_verification_accumulator_set<single_msg_aggregate_verification_mode<>>(agg_sig);
+                registered_acc(registry);
+                ::nil::crypto3::aggregate_verify_single_msg<SchemePopSign>(*msgs_it, registered_acc);
+                ::nil::crypto3::aggregate_verify_single_msg<SchemePopSign>(*sks_it, registered_acc);
+                BOOST_CHECK_EQUAL(
+                    boost::accumulators::extract_result<single_msg_aggregate_verification_acc<>>(registered_acc), false);
+
+                registry.register_key(pubkey_type<>(sks_it->front()), my_proofs.front());
+                BOOST_CHECK_EQUAL(registry.verify_pending(), std::size_t(0));
+                auto reregistered_acc =
+                    single_msg_aggregate_verification_accumulator_set<single_msg_aggregate_verification_mode<>>(agg_sig);
+                reregistered_acc(registry);
+                ::nil::crypto3::aggregate_verify_single_msg<SchemePopSign>(*msgs_it, reregistered_acc);
+                ::nil::crypto3::aggregate_verify_single_msg<SchemePopSign>(*sks_it, reregistered_acc);
+                BOOST_CHECK_EQUAL(
+                    boost::accumulators::extract_result<single_msg_aggregate_verification_acc<>>(reregistered_acc),
+                    true);
+
+                const validator_registry<SchemePopSign> committee(*sks_it);
+                std::vector<bool> participation(sks_it->size(), true);
+                BOOST_CHECK_EQUAL(committee.aggregate_verify(*msgs_it, participation, agg_sig), true);
+                BOOST_CHECK_EQUAL(committee.aggregate_verify(*hashed_msg, participation, agg_sig), true);
+                participation.front() = false;
+                BOOST_CHECK_EQUAL(committee.aggregate_verify(*msgs_it, participation, agg_sig), false);
+                BOOST_CHECK_EQUAL(
+                    committee.aggregate_verify(*msgs_it, participation, signature_type<>(agg_sig - my_sigs.front())),
+                    true);
+                BOOST_CHECK_EQUAL(committee.aggregate_verify(*msgs_it, std::vector<bool>(sks_it->size(), false),
+                                                             signature_type<>::zero()),
+                                  false);
+            }
+
             sks_it++;
             etalon_sigs_it++;
             msgs_it++;
@@ -2017,6 +2382,200 @@ BOOST_AUTO_TEST_CASE(bls_pop_mss) {
     conformity_pop_test_case<scheme_type, scheme_pop_prove_type>::process(sks_n, msgs, sigs_n, agg_sigs);
 }
 
+BOOST_AUTO_TEST_CASE(bls_threshold_mss) {
+    using curve_type = algebra::curves::bls12_381;
+    using scheme_type = bls<bls_default_public_params<>, bls_mss_ro_version, bls_basic_scheme, curve_type>;
+
+    using privkey_type = private_key<scheme_type>;
+    using pubkey_type = public_key<scheme_type>;
+    using signature_type = typename pubkey_type::signature_type;
+    using sss_type = shamir_sss<typename pubkey_type::public_key_group_type>;
+
+    using threshold_mode = threshold_aggregation_processing_mode<scheme_type>;
+    using threshold_op = typename threshold_mode::op_type;
+    using threshold_aggregation_acc_set = aggregation_accumulator_set<threshold_mode>;
+    using threshold_aggregation_acc =
+        typename boost::mpl::front<typename threshold_aggregation_acc_set::features_type>::type;
+
+    const std::size_t t = 3;
+    const std::size_t n = 5;
+    const auto coeffs = sss_type::get_poly(t, n);
+    const std::vector<share_sss<sss_type>> shares = ::nil::crypto3::deal_shares<sss_type>(coeffs, n);
+    const privkey_type sk(coeffs.front());
+
+    const std::string msg_str = "threshold message";
+    const std::vector<std::uint8_t> msg(msg_str.begin(), msg_str.end());
+
+    std::vector<typename threshold_op::indexed_signature_type> partials;
+    std::vector<public_share_sss<sss_type>> public_shares;
+    for (std::size_t i = n - t; i < n; ++i) {
+        partials.emplace_back(shares[i].get_index(), static_cast<signature_type>(::nil::crypto3::sign(
+                                                         msg, privkey_type(shares[i].get_value()))));
+        public_shares.emplace_back(static_cast<public_share_sss<sss_type>>(shares[i]));
+    }
+
+    std::vector<bool> partials_validity;
+    threshold_op::verify_partial_signatures(msg, public_shares, partials, std::back_inserter(partials_validity));
+    BOOST_CHECK_EQUAL(static_cast<std::size_t>(std::count(partials_validity.begin(), partials_validity.end(), true)),
+                      t);
+    partials.back().second = partials.back().second + partials.front().second;
+    partials_validity.clear();
+    threshold_op::verify_partial_signatures(msg, public_shares, partials, std::back_inserter(partials_validity));
+    BOOST_CHECK_EQUAL(partials_validity.back(), false);
+    BOOST_CHECK_EQUAL(partials_validity.front(), true);
+    partials.back().second = partials.back().second - partials.front().second;
+
+    const signature_type sig = ::nil::crypto3::sign(msg, sk);
+    lagrange_coefficients_cache<sss_type> coefficients_cache(4);
+    for (std::size_t round = 0; round < 2; ++round) {
+        auto threshold_agg_acc = threshold_aggregation_acc_set(nil::crypto3::accumulators::threshold_value = t);
+        threshold_agg_acc(&coefficients_cache);
+        ::nil::crypto3::aggregate<scheme_type>(partials, threshold_agg_acc);
+        BOOST_CHECK_EQUAL(boost::accumulators::extract_result<threshold_aggregation_acc>(threshold_agg_acc), sig);
+        BOOST_CHECK_EQUAL(coefficients_cache.size(), 1);
+    }
+
+    // a partial signature is counted once, the result does not depend on the cache
+    partials.emplace_back(partials.front());
+    auto threshold_agg_acc = threshold_aggregation_acc_set(nil::crypto3::accumulators::threshold_value = t);
+    ::nil::crypto3::aggregate<scheme_type>(partials, threshold_agg_acc);
+    BOOST_CHECK_EQUAL(boost::accumulators::extract_result<threshold_aggregation_acc>(threshold_agg_acc), sig);
+    BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::verify(msg, sig, sk)), true);
+
+    // fewer partial signatures than the threshold do not determine the signature, a repeated one does not count
+    using indexed_signature_type = typename threshold_op::indexed_signature_type;
+    std::vector<indexed_signature_type> short_partials(partials.begin(), partials.begin() + t - 1);
+    short_partials.emplace_back(short_partials.front());
+    auto short_threshold_agg_acc = threshold_aggregation_acc_set(nil::crypto3::accumulators::threshold_value = t);
+    ::nil::crypto3::aggregate<scheme_type>(short_partials, short_threshold_agg_acc);
+    BOOST_CHECK_THROW(boost::accumulators::extract_result<threshold_aggregation_acc>(short_threshold_agg_acc),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(bls_weighted_threshold_mss) {
+    using curve_type = algebra::curves::bls12_381;
+    using scheme_type = bls<bls_default_public_params<>, bls_mss_ro_version, bls_basic_scheme, curve_type>;
+
+    using privkey_type = private_key<scheme_type>;
+    using pubkey_type = public_key<scheme_type>;
+    using signature_type = typename pubkey_type::signature_type;
+    using sss_type = weighted_shamir_sss<typename pubkey_type::public_key_group_type>;
+
+    using threshold_mode = threshold_aggregation_processing_mode<scheme_type, weighted_shamir_sss>;
+    using threshold_op = typename threshold_mode::op_type;
+    using threshold_aggregation_acc_set = aggregation_accumulator_set<threshold_mode>;
+    using threshold_aggregation_acc =
+        typename boost::mpl::front<typename threshold_aggregation_acc_set::features_type>::type;
+
+    const std::size_t t = 3;
+    const std::size_t n = 4;
+    const typename sss_type::weights_type weights = {{1, 1}, {2, 2}, {3, 1}, {4, 2}};
+    const auto coeffs = sss_type::get_poly(t, n);
+    const std::vector<share_sss<sss_type>> shares = ::nil::crypto3::deal_shares<sss_type>(coeffs, n, weights);
+    const privkey_type sk(coeffs.front());
+
+    const std::string msg_str = "weighted threshold message";
+    const std::vector<std::uint8_t> msg(msg_str.begin(), msg_str.end());
+
+    // the participants 2 and 4 hold 4 parts together, more than the threshold
+    const typename sss_type::weights_type confirmed_weights = {{2, 2}, {4, 2}};
+    typename sss_type::coeffs_cache_type coeffs_cache(1);
+    std::vector<typename threshold_op::indexed_signature_type> partials;
+    std::vector<public_share_sss<sss_type>> public_shares;
+    for (const auto &share : shares) {
+        if (confirmed_weights.count(share.get_index()) == 0) {
+            continue;
+        }
+        const auto collapsed_share = share.to_shamir(confirmed_weights, coeffs_cache);
+        BOOST_CHECK(collapsed_share == share.to_shamir(confirmed_weights));
+        partials.emplace_back(share.get_index(),
+                              static_cast<signature_type>(
+                                  ::nil::crypto3::sign(msg, privkey_type(collapsed_share.get_value()))));
+        public_shares.emplace_back(static_cast<public_share_sss<sss_type>>(share));
+    }
+    BOOST_CHECK_EQUAL(coeffs_cache.size(), 1);
+
+    std::vector<bool> partials_validity;
+    threshold_op::verify_partial_signatures(msg, public_shares, partials, confirmed_weights, coeffs_cache,
+                                            std::back_inserter(partials_validity));
+    BOOST_CHECK_EQUAL(static_cast<std::size_t>(std::count(partials_validity.begin(), partials_validity.end(), true)),
+                      partials.size());
+
+    auto threshold_agg_acc = threshold_aggregation_acc_set(nil::crypto3::accumulators::threshold_value = t);
+    threshold_agg_acc(confirmed_weights);
+    ::nil::crypto3::aggregate<scheme_type>(partials, threshold_agg_acc);
+    BOOST_CHECK_EQUAL(boost::accumulators::extract_result<threshold_aggregation_acc>(threshold_agg_acc),
+                      static_cast<signature_type>(::nil::crypto3::sign(msg, sk)));
+
+    // the participant 4 alone holds 2 parts, fewer than the threshold
+    const typename sss_type::weights_type short_weights = {{4, 2}};
+    auto short_threshold_agg_acc = threshold_aggregation_acc_set(nil::crypto3::accumulators::threshold_value = t);
+    short_threshold_agg_acc(short_weights);
+    ::nil::crypto3::aggregate<scheme_type>(partials.begin() + 1, partials.end(), short_threshold_agg_acc);
+    BOOST_CHECK_THROW(boost::accumulators::extract_result<threshold_aggregation_acc>(short_threshold_agg_acc),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(bls_msp_mss) {
+    using curve_type = algebra::curves::bls12_381;
+    using scheme_type = bls<bls_default_public_params<>, bls_mss_ro_version, bls_msp_scheme, curve_type>;
+
+    using privkey_type = private_key<scheme_type>;
+    using pubkey_type = public_key<scheme_type>;
+    using _privkey_type = typename privkey_type::private_key_type;
+    using _pubkey_type = typename pubkey_type::public_key_type;
+    using signature_type = typename pubkey_type::signature_type;
+    using scalar_integral_type = typename _privkey_type::integral_type;
+    using keyed_signature_type = typename aggregate_op<scheme_type>::keyed_signature_type;
+
+    const std::vector<privkey_type> sks = {
+        privkey_type(_privkey_type(scalar_integral_type("1111111111111111111111111111111111111111"))),
+        privkey_type(_privkey_type(scalar_integral_type("2222222222222222222222222222222222222222"))),
+        privkey_type(_privkey_type(scalar_integral_type("3333333333333333333333333333333333333333"))),
+    };
+
+    const std::string msg_str = "multisignature message";
+    const std::vector<std::uint8_t> msg(msg_str.begin(), msg_str.end());
+
+    std::vector<keyed_signature_type> keyed_sigs;
+    std::vector<_pubkey_type> pks;
+    for (const auto &sk : sks) {
+        keyed_sigs.emplace_back(sk.public_key_data(), static_cast<signature_type>(::nil::crypto3::sign(msg, sk)));
+        pks.emplace_back(sk.public_key_data());
+    }
+    const signature_type agg_sig = ::nil::crypto3::aggregate<scheme_type>(keyed_sigs);
+    const _pubkey_type apk = scheme_type::bls_scheme_type::aggregate_public_keys(pks);
+    BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::verify(msg, agg_sig, pubkey_type(apk))), true);
+    BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::aggregate_verify_single_msg<scheme_type>(msg, sks, agg_sig)),
+                      true);
+
+    // the coefficients do not depend on the order of the signers
+    std::reverse(keyed_sigs.begin(), keyed_sigs.end());
+    BOOST_CHECK_EQUAL(static_cast<signature_type>(::nil::crypto3::aggregate<scheme_type>(keyed_sigs)), agg_sig);
+
+    // a signer passed twice is taken once, both by the aggregation and by the verification
+    std::vector<keyed_signature_type> repeated_keyed_sigs(keyed_sigs);
+    repeated_keyed_sigs.push_back(keyed_sigs.front());
+    BOOST_CHECK_EQUAL(static_cast<signature_type>(::nil::crypto3::aggregate<scheme_type>(repeated_keyed_sigs)),
+                      agg_sig);
+    std::vector<privkey_type> repeated_sks(sks);
+    repeated_sks.push_back(sks.front());
+    BOOST_CHECK_EQUAL(
+        static_cast<bool>(::nil::crypto3::aggregate_verify_single_msg<scheme_type>(msg, repeated_sks, agg_sig)), true);
+
+    // a plain sum of the signatures is not a multisignature
+    signature_type sum_sig = signature_type::zero();
+    for (const auto &keyed_sig : keyed_sigs) {
+        sum_sig = sum_sig + keyed_sig.second;
+    }
+    BOOST_CHECK_EQUAL(static_cast<bool>(::nil::crypto3::aggregate_verify_single_msg<scheme_type>(msg, sks, sum_sig)),
+                      false);
+
+    const std::vector<privkey_type> other_sks(sks.begin(), sks.end() - 1);
+    BOOST_CHECK_EQUAL(
+        static_cast<bool>(::nil::crypto3::aggregate_verify_single_msg<scheme_type>(msg, other_sks, agg_sig)), false);
+}
+
 // BOOST_AUTO_TEST_CASE(bls_pop_mps) {
 //     // TODO: add test
 // }